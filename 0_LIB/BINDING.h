@@ -0,0 +1,24 @@
+/******************************************************************************
+ * @file        BINDING.h
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Options of the XXX_HANDLERS_BINDING configurations: how the
+ *              ISRs of a driver call the application code.
+ * @details     - BINDING_RUNTIME: the ISR calls the callback registered at run
+ *                time, through a function pointer. The compiler can't see the
+ *                callback, so the ISR saves all the call-clobbered registers.
+ *              - BINDING_STATIC: the ISR calls XXX_Handler() directly, the
+ *                callbacks are ignored. The driver defines weak empty handlers,
+ *                the application overrides the ones it needs: they are bound
+ *                at link time. Build with -flto, so each handler is inlined in
+ *                its vector and only the registers it uses are saved.
+ * @version     1.0.0
+ * @date        2022-07-20
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#ifndef BINDING_H
+#define BINDING_H
+
+#define BINDING_RUNTIME     0
+#define BINDING_STATIC      1
+
+#endif          /* BINDING_H */
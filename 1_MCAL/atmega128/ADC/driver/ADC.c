@@ -9,23 +9,50 @@
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
 #include "GIE.h"
+#include "TIMER.h"
+#include "TIMER_cfg.h"
+#include "EEPROM.h"
 #include "ADC_reg.h"
 #include "ADC.h"
 #include "ADC_cfg.h"
 
+#if (TIMER_HANDLERS_BINDING == BINDING_STATIC)
+#error "ADC_StartCapture: the timer callbacks are ignored with BINDING_STATIC, set TIMER_HANDLERS_BINDING to BINDING_RUNTIME"
+#endif
+
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                          PRIVATE FUNCTIONS PROTOTYPES                       */
 /*                                                                             */
 /*-----------------------------------------------------------------------------*/
 static ERROR_t ADC_InitChannel(const ADC_CHANNEL_t channel);
-static ERROR_t ADC_SetReference(const ADC_REFERENCE_t reference);
-static ERROR_t ADC_SetAdjustment(const ADC_ADJUST_t adjustment);
-static ERROR_t ADC_SetChannel(const ADC_CHANNEL_t channel);
 static ERROR_t ADC_ControlAutoTrigger(const ADC_AUTO_TRIGGER_t autoTrigger);
 static ERROR_t ADC_SetPrescaler(ADC_PRESCALER_t prescaler);
 static ERROR_t ADC_GetChannelIndex(const ADC_CHANNEL_t channel, s8_t * const index);
 static ERROR_t ADC_StartConversion(void);
+static u16_t ADC_GetResult(void);
+static void ADC_DropConversion(void);
+static ERROR_t ADC_QueueRequest(const ADC_CHANNEL_t channel, u16_t * const ptrToValue,
+                                void (* const callback) (void), const u16_t referenceMillivolts);
+static void ADC_StartRequest(void);
+static void ADC_RequestConversionComplete(void);
+static void ADC_FastConversionComplete(void);
+static u16_t ADC_GetReferenceMillivolts(const u8_t index);
+static u16_t ADC_ScaleMillivolts(const u16_t value, const u8_t shift, const u16_t referenceMillivolts);
+static u8_t ADC_BuildAdmux(const u8_t index);
+static void ADC_CallHandler(void);
+static void ADC_ScanConversionComplete(void);
+static u32_t ADC_GetConversionCycles(const u8_t index);
+static u16_t ADC_Filter(const u8_t slot, const u16_t value);
+static void ADC_CaptureCompare(void);
+static void ADC_CheckWindow(const u8_t slot, const u16_t value);
+#if (ADC_SCAN_STATS)
+static void ADC_UpdateStats(const u8_t slot, const u16_t value);
+static u16_t ADC_Sqrt(u32_t value);
+#endif
+static u16_t ADC_Correct(const ADC_CHANNEL_t channel, const u16_t value, const u8_t shift);
+static void ADC_LoadCalibration(void);
+static ERROR_t ADC_SaveCalibration(const ADC_CHANNEL_t channel);
 
 
 /*-----------------------------------------------------------------------------*/
@@ -34,8 +61,121 @@ static ERROR_t ADC_StartConversion(void);
 /*                                                                             */
 /*-----------------------------------------------------------------------------*/
 static void (* volatile ADC_Callback)(void) = NULL;
-static ADC_t ADC_CurrentRunningADC = 0;
-static volatile u16_t * ADC_AsyncResult = NULL;
+static u8_t ADC_CurrentChannel = NUM_OF_USED_ADC_CHANNELS;        /*!< Channel selected now, NUM_OF_USED_ADC_CHANNELS if none */
+static u8_t ADC_ChannelIndexes[NUM_OF_USED_ADC_CHANNELS];           /*!< Index in adcConfigs + 1 of each channel, 0 if not configured */
+static u8_t ADC_ChannelAdmux[NUM_OF_USED_ADC_CHANNELS];             /*!< ADMUX of each channel: reference, adjustment and input */
+static u8_t ADC_AsyncShift = 0;                 /*!< Extra bits of the async result */
+static volatile u8_t ADC_AsyncSamplesLeft = 0;  /*!< Conversions left for the async result */
+static volatile u16_t ADC_AsyncSum = 0;
+static volatile u8_t ADC_AsyncIsSettling = 0;   /*!< Drop the next async conversion */
+static u8_t ADC_IsSettling = 0;                 /*!< A differential input was just selected */
+
+/*!< An async read waiting in the queue */
+typedef struct {
+    ADC_CHANNEL_t   channel;
+    u16_t *         result;
+    void (* callback)(void);
+    u16_t           referenceMillivolts;    /*!< Convert the result to mV if not 0 */
+} ADC_REQUEST_t;
+
+static ADC_REQUEST_t ADC_Queue[ADC_QUEUE_LENGTH];
+static volatile u8_t ADC_QueueHead = 0;         /*!< Request converted now */
+static volatile u8_t ADC_QueueCount = 0;
+
+typedef enum {
+    ADC_MODE_SINGLE,        /*!< Idle, ADC_Read() */
+    ADC_MODE_ASYNC,         /*!< Queued async reads */
+    ADC_MODE_SCAN,          /*!< Background scan of adcScanChannels */
+    ADC_MODE_CAPTURE,       /*!< Timer paced capture */
+    ADC_MODE_QUIET,         /*!< ADC_ReadQuiet(): the ISR only wakes the CPU */
+    ADC_MODE_FAST,          /*!< 8 bits free running capture */
+} ADC_MODE_t;
+
+static volatile ADC_MODE_t ADC_Mode = ADC_MODE_SINGLE;
+
+#define ADC_SCAN_NO_SLOT    (0xFF)
+
+static u8_t ADC_ScanAdmux[NUM_OF_USED_ADC_CHANNELS];                /*!< ADMUX of each slot of the scan */
+static u8_t ADC_ScanShift[NUM_OF_USED_ADC_CHANNELS];                /*!< Extra bits of each slot */
+static u8_t ADC_ScanSlots[NUM_OF_USED_ADC_CHANNELS];                /*!< Slot of each channel, ADC_SCAN_NO_SLOT if not scanned */
+static volatile u16_t ADC_ScanResults[NUM_OF_USED_ADC_CHANNELS];    /*!< Last result of each slot */
+static volatile u8_t ADC_ScanIndex = 0;                             /*!< Slot converted now */
+static volatile u16_t ADC_ScanSequence = 0;                         /*!< Completed sweeps */
+static u8_t ADC_ScanSamplesLeft = 0;                                /*!< Conversions left for the slot */
+static u16_t ADC_ScanSum = 0;                                       /*!< Sum of the conversions of the slot */
+static u8_t ADC_ScanSettle[NUM_OF_USED_ADC_CHANNELS];               /*!< 1 if the first conversion of the slot is dropped */
+static u8_t ADC_ScanIsSettling = 0;                                 /*!< The conversion in progress is dropped */
+
+typedef struct {
+    const ADC_FILTER_CONFIGS_t * config;    /*!< NULL if the slot is not filtered */
+    u8_t    isPrimed;                       /*!< The windows are filled with the first result */
+    u16_t   medianWindow[ADC_MEDIAN_MAX_TAPS];
+    u8_t    medianIndex;
+    u16_t   boxcarWindow[ADC_BOXCAR_MAX_LENGTH];
+    u8_t    boxcarIndex;
+    u16_t   boxcarSum;
+    s32_t   emaQ15;                         /*!< Output of the EMA * 2^15 */
+} ADC_FILTER_t;
+
+static ADC_FILTER_t ADC_Filters[NUM_OF_USED_ADC_CHANNELS];          /*!< Filters of each slot */
+
+typedef struct {
+    const ADC_WINDOW_CONFIGS_t * config;    /*!< NULL if the slot has no window */
+    u16_t   low;
+    u16_t   high;
+    volatile ADC_WINDOW_STATE_t state;
+} ADC_WINDOW_t;
+
+static ADC_WINDOW_t ADC_Windows[NUM_OF_USED_ADC_CHANNELS];          /*!< Window of each slot */
+static void (* volatile ADC_WindowCallback)(const ADC_CHANNEL_t channel, const ADC_WINDOW_STATE_t state) = NULL;
+
+#if (ADC_SCAN_STATS)
+typedef struct {
+    u16_t   min;
+    u16_t   max;
+    u32_t   sum;
+    u64_t   sumOfSquares;
+    u16_t   samples;
+} ADC_STATS_SUMS_t;
+
+static ADC_STATS_SUMS_t ADC_Stats[NUM_OF_USED_ADC_CHANNELS];        /*!< Window of each slot */
+#endif
+
+static u16_t * ADC_CaptureBuffer = NULL;                            /*!< 2 halves of ADC_CaptureLength samples */
+static u16_t ADC_CaptureLength = 0;
+static u16_t ADC_CaptureIndex = 0;                                  /*!< Next sample in ADC_CaptureBuffer */
+static u16_t ADC_CapturePeriod = 0;                                 /*!< Timer ticks between samples */
+static u16_t ADC_CaptureNextCompare = 0;                            /*!< Time of the next sample */
+static u8_t ADC_CaptureIsConverting = 0;                            /*!< A conversion was started by the last compare */
+static u8_t ADC_CaptureIsSettling = 0;                              /*!< Drop the first result */
+static void (* ADC_CaptureCallback)(const u16_t * const samples) = NULL;
+static ADC_CAPTURE_STATS_t ADC_CaptureStats;
+
+static volatile u8_t ADC_QuietIsDone = 0;                           /*!< Set by the ISR in ADC_MODE_QUIET */
+
+static u8_t * ADC_FastBuffer = NULL;                                /*!< 2 halves of ADC_FastLength samples */
+static u16_t ADC_FastLength = 0;
+static u16_t ADC_FastIndex = 0;                                     /*!< Next sample in ADC_FastBuffer */
+static u8_t ADC_FastSignFlip = 0;                                   /*!< 0x80 for a differential input */
+static u8_t ADC_FastIsSettling = 0;                                 /*!< Drop the first sample */
+static u32_t ADC_FastHalves = 0;                                    /*!< Halves filled */
+static void (* ADC_FastCallback)(const u8_t * const samples) = NULL;
+
+/*!< Calibration record of a channel in EEPROM */
+typedef struct {
+    u16_t   gainQ15;
+    s16_t   offset;
+    u16_t   check;                  /*!< gainQ15 ^ offset ^ ADC_CAL_CHECK_KEY: an erased EEPROM is not valid */
+} ADC_CAL_RECORD_t;
+
+#define ADC_CAL_CHECK_KEY   (0xA5C3U)
+#define ADC_CAL_GAIN_ONE    (0x8000U)   /*!< 1.0 in Q15 */
+
+static u16_t ADC_CalGains[NUM_OF_USED_ADC_CHANNELS];                /*!< Q15, in [0, 2) */
+static s16_t ADC_CalOffsets[NUM_OF_USED_ADC_CHANNELS];
+static u16_t ADC_CalLowRaw[NUM_OF_USED_ADC_CHANNELS];               /*!< Raw result at the low point */
+static u16_t ADC_CalLowExpected[NUM_OF_USED_ADC_CHANNELS];
+static u8_t ADC_CalIsLowDone[NUM_OF_USED_ADC_CHANNELS];
 
 
 /*-----------------------------------------------------------------------------*/
@@ -44,6 +184,28 @@ static volatile u16_t * ADC_AsyncResult = NULL;
 /*                                                                             */
 /*-----------------------------------------------------------------------------*/
 #define ASSERT_VALID_ADC(channel)   ((channel) < NUM_OF_ADC_CHANNELS )
+#define ASSERT_VALID_ADJUST(adjust)     ( (adjust) == ADC_ADJUST_RIGHT || (adjust) == ADC_ADJUST_LEFT )
+#define ASSERT_VALID_RESOLUTION(resolution)  ((resolution) <= ADC_RESOLUTION_13_BITS)
+
+/*!< Inputs of the gain stage. Their results are in two's complement */
+#define ADC_IS_DIFFERENTIAL(adc)    ( ((adc) >= ADC_DIFF_0_0_X10) && ((adc) < NUM_OF_ADC_CHANNELS) )
+#define ADC_MUX_MASK                (0x1F)
+#define ADC_SIGN_BIT                (0x200)     /*!< Sign of a 10 bits result */
+
+#define ADC_INTERNAL_MILLIVOLTS     (2560U)
+
+/*!< 4^n conversions for n extra bits: 64 * 1023 still fits in u16_t */
+#define ADC_SAMPLES_PER_RESULT(shift)   ((u8_t)(1U << (2 * (shift))))
+
+/*!< A conversion takes 13 ADC clocks, ADC_PRESCALER_t n divides by 2^(n + 1) */
+#define ADC_CYCLES_PER_CONVERSION(prescaler)    (13UL << ((prescaler) + 1))
+
+/*!< TIMER_RES_OCA, TIMER_RES_OCB and TIMER_RES_OCC follow the order of TIMER_OCx_t */
+#define ADC_CAPTURE_TIMER_RESOURCES     (TIMER_RES_COUNTER | (TIMER_RES_OCA << ADC_CAPTURE_TIMER_OC))
+
+#define ADC_SLEEP_MODE_MASK             ((1 << SLEEP_SM2) | (1 << SLEEP_SM1) | (1 << SLEEP_SM0))
+#define ADC_SLEEP_MODE_NOISE_REDUCTION  (1 << SLEEP_SM0)
+
 #define ASSERT_VALID_REFERENCE(reference)   ( reference == ADC_REFERENCE_AREF || \
                                               reference == ADC_REFERENCE_AVCC || \
                                               reference == ADC_REFERENCE_INTERNAL )
@@ -58,6 +220,19 @@ ERROR_t ADC_Init(void) {
     ERROR_t error = ERROR_OK;
     u8_t i = 0;
 
+    /*!< Channel table: the lookup and the ADMUX of a channel are then O(1) */
+    for(i = 0; i < countChannelsConfigured; ++i) {
+        if( (adcConfigs[i].channel < NUM_OF_USED_ADC_CHANNELS) && ASSERT_VALID_ADC(adcConfigs[i].adc) &&
+            ASSERT_VALID_REFERENCE(adcConfigs[i].reference) && ASSERT_VALID_ADJUST(adcConfigs[i].adjust) ) {
+            ADC_ChannelIndexes[adcConfigs[i].channel] = i + 1;
+            ADC_ChannelAdmux[adcConfigs[i].channel] = ADC_BuildAdmux(i);
+        } else {
+            return ERROR_INVALID_PARAMETER;
+        }
+    }
+
+    ADC_LoadCalibration();
+
     for(i = 0; i < countChannelsConfigured; ++i) {
         error |= ADC_InitChannel(adcConfigs[i].channel);
 
@@ -74,12 +249,18 @@ ERROR_t ADC_Init(void) {
 ERROR_t ADC_Read(const ADC_CHANNEL_t channel, u16_t * const ptrToValue) {
     ERROR_t error = ERROR_OK;
     s8_t i = 0;
+    u8_t count = 0;
+    u16_t sum = 0;
+
+    if(ADC_MODE_SINGLE != ADC_Mode) {
+        return ERROR_BUSY;
+    }
 
     error |= ADC_GetChannelIndex(channel, &i);
 
-    if( ASSERT_VALID_ADC(adcConfigs[i].adc)) {
+    if( (i >= 0) && ASSERT_VALID_RESOLUTION(adcConfigs[i].resolution) ) {
 
-        if(ADC_CurrentRunningADC != adcConfigs[i].adc) {
+        if(ADC_CurrentChannel != channel) {
             error = ADC_InitChannel(channel);
             if(error != ERROR_OK) {
                 return error;
@@ -87,19 +268,22 @@ ERROR_t ADC_Read(const ADC_CHANNEL_t channel, u16_t * const ptrToValue) {
         }
 
         error |= ADC_DisableInterrupt();
-        error |= ADC_StartConversion();
-        while(BIT_IS_CLEAR(ADC->ADCSRA, ADIF)) {
-            /*!< Wait for conversion to finish */
-        };
-        BIT_SET(ADC->ADCSRA, ADIF);
-
-        if(BIT_IS_SET(ADC->ADMUX, ADLAR)) {
-            *ptrToValue  = ( (ADC->ADCL) >> 6) & 0x3;
-            *ptrToValue |= (u16_t)(ADC->ADCH) << 2;
-        } else {       
-            *ptrToValue  = (u8_t)(ADC->ADCL);
-            *ptrToValue |= ((u16_t)(ADC->ADCH) & 0x3) << 8;
+
+        if(ADC_IsSettling) {
+            ADC_DropConversion();
+        }
+
+        for(count = ADC_SAMPLES_PER_RESULT(adcConfigs[i].resolution); count > 0; --count) {
+            error |= ADC_StartConversion();
+            do {
+                ADC_WAIT();     /*!< Wait for conversion to finish */
+            } while(BIT_IS_CLEAR(ADC->ADCSRA, ADIF));
+            BIT_SET(ADC->ADCSRA, ADIF);
+
+            sum += ADC_GetResult();
         }
+
+        *ptrToValue = ADC_Correct(channel, sum >> adcConfigs[i].resolution, adcConfigs[i].resolution);
     } else {
         error |= ERROR_INVALID_PARAMETER;
     }
@@ -107,37 +291,235 @@ ERROR_t ADC_Read(const ADC_CHANNEL_t channel, u16_t * const ptrToValue) {
     return error;
 }
 
-ERROR_t ADC_ReadAsync(const ADC_CHANNEL_t channel, u16_t * const ptrToValue, void (* const callback) (void)) {
+ERROR_t ADC_ReadQuiet(const ADC_CHANNEL_t channel, u16_t * const ptrToValue) {
     ERROR_t error = ERROR_OK;
+    const u8_t u8_tSreg = SREG;
     s8_t i = 0;
+    u8_t count = 0;
+    u16_t sum = 0;
+#if (ADC_QUIET_MASK_WAKEUPS)
+    u8_t eimsk = 0;
+    u8_t timsk = 0;
+#endif
+
+    if(NULL == ptrToValue) {
+        return ERROR_NULL_POINTER;
+    }
 
-    error |= ADC_GetChannelIndex(channel, &i);
+    if(ADC_MODE_SINGLE != ADC_Mode) {
+        return ERROR_BUSY;
+    }
 
-    if( ASSERT_VALID_ADC(adcConfigs[i].adc)) {
+    error |= ADC_GetChannelIndex(channel, &i);
+    if( (ERROR_OK != error) || (i < 0) || !ASSERT_VALID_RESOLUTION(adcConfigs[i].resolution) ) {
+        return error | ERROR_INVALID_PARAMETER;
+    }
 
-        if(ADC_CurrentRunningADC != adcConfigs[i].adc) {
-            error = ADC_InitChannel(channel);
-            if(error) {
-                return error;
-            }
+    if(ADC_CurrentChannel != channel) {
+        error |= ADC_InitChannel(channel);
+        if(ERROR_OK != error) {
+            return error;
         }
+    }
 
-        if(NULL != ptrToValue) {
-            ADC_AsyncResult = ptrToValue;
-        } else {
-            error = ERROR_NULL_POINTER;
+    if(ADC_IsSettling) {
+        ADC_DropConversion();       /*!< Its noise does not matter */
+    }
+
+    GIE_Disable();
+
+#if (ADC_QUIET_MASK_WAKEUPS)
+    eimsk = EIMSK;
+    timsk = ADC_TIMSK;
+    EIMSK = 0;
+    ADC_TIMSK = timsk & ~((1 << TIMSK_TOIE0) | (1 << TIMSK_OCIE0));
+#endif
+
+    ADC_Mode = ADC_MODE_QUIET;
+    error |= ADC_DisableInterrupt();            /*!< Clear ADIF */
+    BIT_SET(ADC->ADCSRA, ADIE);
+    MCUCR = (MCUCR & ~ADC_SLEEP_MODE_MASK) | ADC_SLEEP_MODE_NOISE_REDUCTION | (1 << SLEEP_SE);
+
+    /*!< Entering the sleep mode starts a conversion if none is in progress. If
+         another interrupt wakes the CPU first, sleep again until it is done */
+    for(count = ADC_SAMPLES_PER_RESULT(adcConfigs[i].resolution); count > 0; --count) {
+        ADC_QuietIsDone = 0;
+        while(!ADC_QuietIsDone) {
+            GIE_Enable();
+            ADC_SLEEP();
+            GIE_Disable();
         }
-        
-        error |= ADC_SetCallback(callback);
-        error |= ADC_EnableInterrupt();
-        error |= ADC_StartConversion();
+
+        sum += ADC_GetResult();
+    }
+
+    BIT_CLR(MCUCR, SLEEP_SE);
+    error |= ADC_DisableInterrupt();
+    ADC_Mode = ADC_MODE_SINGLE;
+
+#if (ADC_QUIET_MASK_WAKEUPS)
+    EIMSK = eimsk;
+    ADC_TIMSK = timsk;
+#endif
+
+    SREG = u8_tSreg;
+
+    *ptrToValue = ADC_Correct(channel, sum >> adcConfigs[i].resolution, adcConfigs[i].resolution);
+
+    return error;
+}
+
+ERROR_t ADC_ReadAsync(const ADC_CHANNEL_t channel, u16_t * const ptrToValue, void (* const callback) (void)) {
+    return ADC_QueueRequest(channel, ptrToValue, callback, 0);
+}
+
+ERROR_t ADC_ReadMillivolts(const ADC_CHANNEL_t channel, u16_t * const ptrToMillivolts) {
+    ERROR_t error = ERROR_OK;
+    u16_t value = 0;
+
+    if(NULL == ptrToMillivolts) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ADC_Read(channel, &value);
+    if(ERROR_OK == error) {
+        error |= ADC_ToMillivolts(channel, value, ptrToMillivolts);
+    }
+
+    return error;
+}
+
+ERROR_t ADC_ReadMillivoltsAsync(const ADC_CHANNEL_t channel, u16_t * const ptrToMillivolts, void (* const callback) (void)) {
+    s8_t i = 0;
+
+    (void)ADC_GetChannelIndex(channel, &i);
+    if( (i < 0) || ADC_IS_DIFFERENTIAL(adcConfigs[i].adc) ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    return ADC_QueueRequest(channel, ptrToMillivolts, callback, ADC_GetReferenceMillivolts(i));
+}
+
+ERROR_t ADC_ToMillivolts(const ADC_CHANNEL_t channel, const u16_t value, u16_t * const ptrToMillivolts) {
+    s8_t i = 0;
+
+    if(NULL == ptrToMillivolts) {
+        return ERROR_NULL_POINTER;
+    }
+
+    (void)ADC_GetChannelIndex(channel, &i);
+    if( (i < 0) || ADC_IS_DIFFERENTIAL(adcConfigs[i].adc) || !ASSERT_VALID_RESOLUTION(adcConfigs[i].resolution) ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    *ptrToMillivolts = ADC_ScaleMillivolts(value, adcConfigs[i].resolution, ADC_GetReferenceMillivolts(i));
+
+    return ERROR_OK;
+}
+
+/**************************************************************************
+ * @brief  Add an async read to the queue, and start it if the converter is
+ *         idle. The result is converted to mV in the ISR if
+ *         referenceMillivolts is not 0.
+ *************************************************************************/
+static ERROR_t ADC_QueueRequest(const ADC_CHANNEL_t channel, u16_t * const ptrToValue,
+                                void (* const callback) (void), const u16_t referenceMillivolts) {
+    ERROR_t error = ERROR_OK;
+    ADC_REQUEST_t * request = NULL;
+    u8_t u8_tSreg = 0;
+    s8_t i = 0;
+
+    if(NULL == ptrToValue) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ADC_GetChannelIndex(channel, &i);
+    if( (ERROR_OK != error) || (i < 0) || !ASSERT_VALID_RESOLUTION(adcConfigs[i].resolution) ) {
+        return error | ERROR_INVALID_PARAMETER;
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+
+    if( ((ADC_MODE_SINGLE != ADC_Mode) && (ADC_MODE_ASYNC != ADC_Mode)) ||
+        (ADC_QueueCount >= ADC_QUEUE_LENGTH) ) {
+        error |= ERROR_BUSY;
     } else {
-        error |= ERROR_INVALID_PARAMETER;
+        request = &ADC_Queue[(ADC_QueueHead + ADC_QueueCount) % ADC_QUEUE_LENGTH];
+        request->channel                = channel;
+        request->result                 = ptrToValue;
+        request->callback               = callback;
+        request->referenceMillivolts    = referenceMillivolts;
+
+        if(0 == ADC_QueueCount++) {
+            ADC_Mode = ADC_MODE_ASYNC;
+            ADC_StartRequest();
+        }
+    }
+
+    SREG = u8_tSreg;
+
+    return error;
+}
+
+/**************************************************************************
+ * @brief  Start the conversions of the request at the head of the queue.
+ *         Called with the interrupts disabled (from the ISR too).
+ *************************************************************************/
+static void ADC_StartRequest(void) {
+    const ADC_CHANNEL_t channel = ADC_Queue[ADC_QueueHead].channel;
+
+    if(ADC_CurrentChannel != channel) {
+        (void)ADC_InitChannel(channel);     /*!< Checked when queued */
+    }
+
+    ADC_AsyncShift = adcConfigs[ADC_ChannelIndexes[channel] - 1].resolution;
+    ADC_AsyncSamplesLeft = ADC_SAMPLES_PER_RESULT(ADC_AsyncShift);
+    ADC_AsyncSum = 0;
+    ADC_AsyncIsSettling = ADC_IsSettling;
+    ADC_IsSettling = 0;
+
+    /*!< Clear ADIF (written with 1), enable the interrupt and start in one write */
+    ADC->ADCSRA |= (1 << ADIF) | (1 << ADIE) | (1 << ADSC);
+}
+
+ERROR_t ADC_ReadSigned(const ADC_CHANNEL_t channel, s16_t * const ptrToValue) {
+    ERROR_t error = ERROR_OK;
+    u16_t value = 0;
+
+    if(NULL == ptrToValue) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ADC_Read(channel, &value);
+    if(ERROR_OK == error) {
+        error |= ADC_ToSigned(channel, value, ptrToValue);
     }
 
     return error;
 }
 
+ERROR_t ADC_ToSigned(const ADC_CHANNEL_t channel, const u16_t value, s16_t * const ptrToSigned) {
+    ERROR_t error = ERROR_OK;
+    s8_t i = 0;
+
+    if(NULL == ptrToSigned) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ADC_GetChannelIndex(channel, &i);
+    if( (ERROR_OK != error) || (i < 0) || !ASSERT_VALID_RESOLUTION(adcConfigs[i].resolution) ) {
+        return error | ERROR_INVALID_PARAMETER;
+    }
+
+    if(ADC_IS_DIFFERENTIAL(adcConfigs[i].adc)) {
+        *ptrToSigned = (s16_t)value - (s16_t)(ADC_SIGN_BIT << adcConfigs[i].resolution);
+    } else {
+        *ptrToSigned = (s16_t)value;
+    }
+
+    return ERROR_OK;
+}
 
 ERROR_t ADC_Enable(void) {  
     BIT_SET(ADC->ADCSRA, ADEN);
@@ -173,148 +555,659 @@ ERROR_t ADC_SetCallback(void (* const callback)(void)) {
     return error;
 }
 
-/*-----------------------------------------------------------------------------*/
-/*                                                                             */
-/*                              PRIVATE FUNCTIONS                              */
-/*                                                                             */
-/*-----------------------------------------------------------------------------*/
-
-static ERROR_t ADC_InitChannel(const ADC_CHANNEL_t channel) {
+ERROR_t ADC_StartScan(void (* const callback)(void)) {
     ERROR_t error = ERROR_OK;
-    s8_t i = 0;
-    
-    /*!< Get the index of the channel in the array, -1 if not found */
-    error |= ADC_GetChannelIndex(channel, &i);
+    s8_t first = -1;
+    s8_t index = -1;
+    u8_t i = 0;
+    u8_t j = 0;
 
-    if(error || (i < 0)) {
-        if(i < 0) {
+    if(ADC_MODE_SINGLE != ADC_Mode) {
+        return ERROR_BUSY;
+    }
+
+    for(j = 0; j < countFiltersConfigured; ++j) {
+        if( (adcFilterConfigs[j].boxcar > ADC_BOXCAR_8) ||
+            ( (ADC_MEDIAN_OFF != adcFilterConfigs[j].median) &&
+              (ADC_MEDIAN_3 != adcFilterConfigs[j].median) &&
+              (ADC_MEDIAN_5 != adcFilterConfigs[j].median) ) ) {
+            return ERROR_INVALID_PARAMETER;
+        }
+    }
+
+    if( (0 == countScanChannelsConfigured) || (countScanChannelsConfigured > NUM_OF_USED_ADC_CHANNELS) ) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    for(i = 0; i < NUM_OF_USED_ADC_CHANNELS; ++i) {
+        ADC_ScanSlots[i] = ADC_SCAN_NO_SLOT;
+    }
+
+    /*!< Build the ADMUX of each slot now, so the ISR only writes it */
+    error |= ADC_GetChannelIndex(adcScanChannels[0], &first);
+    for(i = 0; (ERROR_OK == error) && (i < countScanChannelsConfigured); ++i) {
+        error |= ADC_GetChannelIndex(adcScanChannels[i], &index);
+
+        if( (first < 0) || (index < 0) || (adcScanChannels[i] >= NUM_OF_USED_ADC_CHANNELS) ||
+            (adcConfigs[index].reference != adcConfigs[first].reference) ||
+            !ASSERT_VALID_RESOLUTION(adcConfigs[index].resolution) ) {
             error |= ERROR_INVALID_PARAMETER;
+        } else {
+            ADC_ScanAdmux[i] = ADC_ChannelAdmux[adcScanChannels[i]];
+            ADC_ScanShift[i] = adcConfigs[index].resolution;
+            /*!< With one slot the input never changes, so it settles once */
+            ADC_ScanSettle[i] = ( ADC_IS_DIFFERENTIAL(adcConfigs[index].adc) && (countScanChannelsConfigured > 1) ) ? 1 : 0;
+            ADC_ScanSlots[adcScanChannels[i]] = i;
+
+            ADC_Filters[i].config = NULL;
+            ADC_Filters[i].isPrimed = 0;
+            for(j = 0; j < countFiltersConfigured; ++j) {
+                if(adcFilterConfigs[j].channel == adcScanChannels[i]) {
+                    ADC_Filters[i].config = &adcFilterConfigs[j];
+                }
+            }
+
+#if (ADC_SCAN_STATS)
+            ADC_Stats[i].samples = 0;
+#endif
+
+            ADC_Windows[i].config = NULL;
+            ADC_Windows[i].state = ADC_WINDOW_UNKNOWN;
+            for(j = 0; j < countWindowsConfigured; ++j) {
+                if(adcWindowConfigs[j].channel == adcScanChannels[i]) {
+                    ADC_Windows[i].config = &adcWindowConfigs[j];
+                    ADC_Windows[i].low    = adcWindowConfigs[j].low;
+                    ADC_Windows[i].high   = adcWindowConfigs[j].high;
+                }
+            }
         }
+    }
 
-        return error;
+    if(ERROR_OK == error) {
+        ADC_DisableInterrupt();
+        error |= ADC_SetPrescaler(adcConfigs[first].prescaler);
+        error |= ADC_ControlAutoTrigger(ADC_AUTO_TRIGGER_OFF);     /*!< The ISR starts each conversion */
     }
 
-    /*!< Disable ADC interrupt */
-    ADC_DisableInterrupt();
-    BIT_SET(ADC->ADCSRA, ADIF);
+    if(ERROR_OK == error) {
+        ADC_Callback = callback;
+        ADC_ScanIndex = 0;
+        ADC_ScanSequence = 0;
+        ADC_ScanSum = 0;
+        ADC_ScanSamplesLeft = ADC_SAMPLES_PER_RESULT(ADC_ScanShift[0]);
+        ADC_ScanIsSettling = ADC_IS_DIFFERENTIAL(adcConfigs[first].adc) ? 1 : 0;
+        ADC_Mode = ADC_MODE_SCAN;
 
-    error |= ADC_SetChannel(channel);
-    error |= ADC_SetPrescaler(adcConfigs[i].prescaler);
-    error |= ADC_ControlAutoTrigger(adcConfigs[i].autoTrigger);
-    error |= ADC_SetAdjustment(adcConfigs[i].adjust);
-    error |= ADC_SetReference(adcConfigs[i].reference);  
+        ADC->ADMUX = ADC_ScanAdmux[0];
+        ADC_CurrentChannel = NUM_OF_USED_ADC_CHANNELS;  /*!< ADC_Read() must select its channel again */
+
+        error |= ADC_Enable();
+        error |= ADC_EnableInterrupt();
+        error |= ADC_StartConversion();
+    }
 
     return error;
 }
 
-ERROR_t ADC_SetReferenceVoltage(const ADC_CHANNEL_t channel, const ADC_REFERENCE_t reference) {
-    ERROR_t error = ERROR_OK;
-    s8_t i = 0;
+ERROR_t ADC_StopScan(void) {
+    if(ADC_MODE_SCAN != ADC_Mode) {
+        return ERROR_OK;
+    }
 
-    error |= ADC_GetChannelIndex(channel, &i);
+    BIT_CLR(ADC->ADCSRA, ADIE);
+    ADC_Mode = ADC_MODE_SINGLE;
 
-    if( (i >= 0) && (ASSERT_VALID_ADC(adcConfigs[i].adc)) && (ASSERT_VALID_REFERENCE(reference)) ) {
-        adcConfigs[i].reference = reference;
-        error |= ADC_SetReference(reference);
-    } else {
-        error |= ERROR_INVALID_PARAMETER;
+    while(BIT_IS_SET(ADC->ADCSRA, ADSC)) {
+        ADC_WAIT();     /*!< Wait for the conversion in progress, its result is dropped */
     }
+    ADC_DisableInterrupt();
 
-    return error;
+    return ERROR_OK;
 }
 
-static ERROR_t ADC_SetReference(const ADC_REFERENCE_t reference) {
+ERROR_t ADC_GetScanResult(const ADC_CHANNEL_t channel, u16_t * const ptrToValue) {
     ERROR_t error = ERROR_OK;
-    
-    switch(reference) {
-        case ADC_REFERENCE_AREF:
-            BIT_CLR(ADC->ADMUX, REFS1);
-            BIT_CLR(ADC->ADMUX, REFS0);
-            break;
-        case ADC_REFERENCE_AVCC:
-            BIT_CLR(ADC->ADMUX, REFS1);
-            BIT_SET(ADC->ADMUX, REFS0);
-            break;
-        case ADC_REFERENCE_INTERNAL:
-            BIT_SET(ADC->ADMUX, REFS1);
-            BIT_SET(ADC->ADMUX, REFS0);
-            break;
-        default:
-            error |= ERROR_INVALID_PARAMETER;
-            break;
+    u8_t u8_tSreg = 0;
+
+    if(NULL == ptrToValue) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if( (channel >= NUM_OF_USED_ADC_CHANNELS) || (ADC_SCAN_NO_SLOT == ADC_ScanSlots[channel]) ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+    if(0 == ADC_ScanSequence) {
+        error |= ERROR_NOT_INITIALIZED;
+    } else {
+        *ptrToValue = ADC_ScanResults[ADC_ScanSlots[channel]];
     }
+    SREG = u8_tSreg;
 
     return error;
 }
 
-static ERROR_t ADC_SetAdjustment(const ADC_ADJUST_t adjustment) {
-    ERROR_t error = ERROR_OK;
-    
-    switch(adjustment) {
-        case ADC_ADJUST_LEFT:
-            BIT_SET(ADC->ADMUX, ADLAR);
-            break;
-        case ADC_ADJUST_RIGHT:
-            BIT_CLR(ADC->ADMUX, ADLAR);
-            break;
-        default:
-            error |= ERROR_INVALID_PARAMETER;
-            break;
+ERROR_t ADC_GetScanSequence(u16_t * const ptrToSequence) {
+    u8_t u8_tSreg = 0;
+
+    if(NULL == ptrToSequence) {
+        return ERROR_NULL_POINTER;
     }
 
-    return error;
+    u8_tSreg = SREG;
+    GIE_Disable();
+    *ptrToSequence = ADC_ScanSequence;
+    SREG = u8_tSreg;
+
+    return ERROR_OK;
 }
 
-static ERROR_t ADC_SetChannel(const ADC_CHANNEL_t channel) {
-    ERROR_t error = ERROR_OK;
-    s8_t i = 0;
+ERROR_t ADC_GetStats(const ADC_CHANNEL_t channel, ADC_STATS_t * const ptrToStats, const u8_t isReset) {
+#if (ADC_SCAN_STATS)
+    ADC_STATS_SUMS_t sums;
+    u8_t u8_tSreg = 0;
+    u8_t slot = 0;
 
-    error |= ADC_GetChannelIndex(channel, &i);
+    if(NULL == ptrToStats) {
+        return ERROR_NULL_POINTER;
+    }
 
-    if(error || (i < 0) || ( !ASSERT_VALID_ADC(adcConfigs[i].adc) )) {
-        return error;
+    if( (channel >= NUM_OF_USED_ADC_CHANNELS) || (ADC_SCAN_NO_SLOT == ADC_ScanSlots[channel]) ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    slot = ADC_ScanSlots[channel];
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+    sums = ADC_Stats[slot];
+    if(isReset) {
+        ADC_Stats[slot].samples = 0;
     }
+    SREG = u8_tSreg;
 
-    if(ADC_CurrentRunningADC != adcConfigs[i].adc) {
-        ADC->ADMUX &= ~(0x1F << MUX0);                  /*!< Clear the channel bits */
-        ADC->ADMUX |= (adcConfigs[i].adc << MUX0);      /*!< Set the channel bits */ 
-        ADC_CurrentRunningADC = adcConfigs[i].adc;      /*!< Set the current channel */
+    ptrToStats->samples = sums.samples;
+
+    if(0 == sums.samples) {
+        ptrToStats->min         = 0;
+        ptrToStats->max         = 0;
+        ptrToStats->peakToPeak  = 0;
+        ptrToStats->mean        = 0;
+        ptrToStats->rms         = 0;
     } else {
-        /* Do nothing */
+        ptrToStats->min         = sums.min;
+        ptrToStats->max         = sums.max;
+        ptrToStats->peakToPeak  = sums.max - sums.min;
+        ptrToStats->mean        = (u16_t)( (sums.sum + (sums.samples / 2)) / sums.samples );
+        ptrToStats->rms         = ADC_Sqrt( (u32_t)(sums.sumOfSquares / sums.samples) );  /*!< < 8192^2 */
     }
-         
-    return error;
+
+    return ERROR_OK;
+#else
+    (void)channel;
+    (void)ptrToStats;
+    (void)isReset;
+
+    return ERROR_NOK;
+#endif
 }
 
-static ERROR_t ADC_ControlAutoTrigger(const ADC_AUTO_TRIGGER_t autoTrigger) {
+ERROR_t ADC_GetTiming(const ADC_CHANNEL_t channel, ADC_TIMING_t * const ptrToTiming) {
     ERROR_t error = ERROR_OK;
-    
-    switch(autoTrigger) {
-        case ADC_AUTO_TRIGGER_OFF:
-            BIT_CLR(ADC->ADCSRA, ADFR);
-            break;
-        case ADC_AUTO_TRIGGER_ON:
-            BIT_SET(ADC->ADCSRA, ADFR);
-            break;
-        default:
-            error |= ERROR_INVALID_PARAMETER;
-            break;
+    s8_t index = -1;
+    s8_t scanned = -1;
+    u32_t sweepCycles = 0;
+    s8_t first = -1;
+    u8_t i = 0;
+
+    if(NULL == ptrToTiming) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ADC_GetChannelIndex(channel, &index);
+    if( (ERROR_OK != error) || (index < 0) || !ASSERT_VALID_RESOLUTION(adcConfigs[index].resolution) ) {
+        return error | ERROR_INVALID_PARAMETER;
+    }
+
+    ptrToTiming->bits                   = 10 + adcConfigs[index].resolution;
+    ptrToTiming->conversionsPerResult   = ADC_SAMPLES_PER_RESULT(adcConfigs[index].resolution);    /*!< Without the dropped one of a differential input */
+    ptrToTiming->latencyUs              = (ADC_GetConversionCycles(index) * 1000UL) / (F_CPU / 1000UL);
+    ptrToTiming->scanRateHz             = 0;
+
+    /*!< A sweep converts all the channels of the scan, with the prescaler of the first one */
+    error |= ADC_GetChannelIndex(adcScanChannels[0], &first);
+    for(i = 0; (first >= 0) && (i < countScanChannelsConfigured); ++i) {
+        error |= ADC_GetChannelIndex(adcScanChannels[i], &scanned);
+        if(scanned >= 0) {
+            sweepCycles += ADC_CYCLES_PER_CONVERSION(adcConfigs[first].prescaler) *
+                           (ADC_SAMPLES_PER_RESULT(adcConfigs[scanned].resolution) +
+                            (ADC_IS_DIFFERENTIAL(adcConfigs[scanned].adc) ? 1 : 0));
+        }
+        if(adcScanChannels[i] == channel) {
+            ptrToTiming->scanRateHz = 1;
+        }
+    }
+
+    if( (0 != ptrToTiming->scanRateHz) && (0 != sweepCycles) ) {
+        ptrToTiming->scanRateHz = F_CPU / sweepCycles;
     }
 
     return error;
 }
 
-static ERROR_t ADC_SetPrescaler(ADC_PRESCALER_t prescaler) {
-    ERROR_t error = ERROR_OK;
-    u8_t prescalerOldValue = 0;
+ERROR_t ADC_SetWindowCallback(void (* const callback)(const ADC_CHANNEL_t channel, const ADC_WINDOW_STATE_t state)) {
+    ADC_WindowCallback = callback;
+    return ERROR_OK;
+}
 
-    /*!< Get the old prescaler value, then clear the prescaler bits */
-    prescalerOldValue = (ADC->ADCSRA >> ADPS0) & 0x07;
-    ADC->ADCSRA &= ~(0x07 << ADPS0);
+ERROR_t ADC_SetWindowThresholds(const ADC_CHANNEL_t channel, const u16_t low, const u16_t high) {
+    u8_t u8_tSreg = 0;
+    u8_t slot = 0;
 
-    /*!< Set the new prescaler value */
-    switch(prescaler) {
-        case ADC_PRESCALER_2:
+    if( (channel >= NUM_OF_USED_ADC_CHANNELS) || (ADC_SCAN_NO_SLOT == ADC_ScanSlots[channel]) || (low > high) ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    slot = ADC_ScanSlots[channel];
+    if(NULL == ADC_Windows[slot].config) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+    ADC_Windows[slot].low  = low;
+    ADC_Windows[slot].high = high;
+    SREG = u8_tSreg;
+
+    return ERROR_OK;
+}
+
+ERROR_t ADC_GetWindowState(const ADC_CHANNEL_t channel, ADC_WINDOW_STATE_t * const ptrToState) {
+    if(NULL == ptrToState) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if( (channel >= NUM_OF_USED_ADC_CHANNELS) || (ADC_SCAN_NO_SLOT == ADC_ScanSlots[channel]) ||
+        (NULL == ADC_Windows[ADC_ScanSlots[channel]].config) ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    *ptrToState = ADC_Windows[ADC_ScanSlots[channel]].state;
+
+    return ERROR_OK;
+}
+
+ERROR_t ADC_StartCapture(const ADC_CHANNEL_t channel, const u32_t sampleRateHz,
+                         u16_t * const buffer, const u16_t length,
+                         void (* const callback)(const u16_t * const samples)) {
+    ERROR_t error = ERROR_OK;
+    s8_t i = -1;
+    u32_t period = 0;
+
+    if( (NULL == buffer) || (NULL == callback) ) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if(ADC_MODE_SINGLE != ADC_Mode) {
+        return ERROR_BUSY;
+    }
+
+    error |= ADC_GetChannelIndex(channel, &i);
+    if( (ERROR_OK != error) || (i < 0) || (0 == length) || (length > 0x7FFF) ) {
+        return error | ERROR_INVALID_PARAMETER;
+    }
+
+    /*!< The period must fit in the 16 bits counter, and be longer than a conversion */
+    period = (sampleRateHz > 0) ? ((F_CPU / ADC_CAPTURE_TIMER_PRESCALER) / sampleRateHz) : 0;
+    if( (period > 0xFFFF) ||
+        ((period * ADC_CAPTURE_TIMER_PRESCALER) <= ADC_CYCLES_PER_CONVERSION(adcConfigs[i].prescaler)) ) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    error |= TIMER_Reserve(TIMER_1, ADC_CAPTURE_TIMER_RESOURCES, TIMER_USER_ADC,
+                           ADC_CAPTURE_TIMER_CLOCK, TIMER_MODE_NORMAL);
+    if(ERROR_OK != error) {
+        return error;
+    }
+
+    error |= ADC_InitChannel(channel);          /*!< Disables the ADC interrupt: the timer ISR reads the results */
+    error |= ADC_ControlAutoTrigger(ADC_AUTO_TRIGGER_OFF);
+    error |= ADC_Enable();
+
+    if(ERROR_OK == error) {
+        ADC_CaptureBuffer       = buffer;
+        ADC_CaptureLength       = length;
+        ADC_CaptureIndex        = 0;
+        ADC_CapturePeriod       = (u16_t)period;
+        ADC_CaptureCallback     = callback;
+        ADC_CaptureIsConverting = 0;
+        ADC_CaptureIsSettling   = ADC_IsSettling;
+        ADC_IsSettling          = 0;
+
+        ADC_CaptureStats.minLatencyTicks    = 0xFFFF;
+        ADC_CaptureStats.maxLatencyTicks    = 0;
+        ADC_CaptureStats.overruns           = 0;
+        ADC_CaptureStats.samples            = 0;
+
+        ADC_Mode = ADC_MODE_CAPTURE;
+
+        /*!< Keep the counter value: TIMER1 may be running for other users */
+        TIMER1_Init(TIMER1_GetTimerValue(), ADC_CAPTURE_TIMER_CLOCK, TIMER_MODE_NORMAL,
+                    NO_OC, ADC_CAPTURE_TIMER_OC);
+
+        ADC_CaptureNextCompare = TIMER1_GetTimerValue() + ADC_CapturePeriod;
+        TIMER1_SetCompareValue(ADC_CaptureNextCompare, ADC_CAPTURE_TIMER_OC);
+        TIMER1_EnableCompareMatchInterrupt(ADC_CAPTURE_TIMER_OC, ADC_CaptureCompare);   /*!< Enables GIE */
+    } else {
+        TIMER_Release(TIMER_1, ADC_CAPTURE_TIMER_RESOURCES, TIMER_USER_ADC);
+    }
+
+    return error;
+}
+
+ERROR_t ADC_StopCapture(void) {
+    if(ADC_MODE_CAPTURE != ADC_Mode) {
+        return ERROR_OK;
+    }
+
+    TIMER1_DisableCompareMatchInterrupt(ADC_CAPTURE_TIMER_OC);
+    TIMER_Release(TIMER_1, ADC_CAPTURE_TIMER_RESOURCES, TIMER_USER_ADC);
+
+    while(BIT_IS_SET(ADC->ADCSRA, ADSC)) {
+        ADC_WAIT();     /*!< Wait for the conversion in progress, its result is dropped */
+    }
+    ADC_DisableInterrupt();
+    ADC_Mode = ADC_MODE_SINGLE;
+
+    return ERROR_OK;
+}
+
+ERROR_t ADC_StartFastCapture(const ADC_CHANNEL_t channel, u8_t * const buffer, const u16_t length,
+                             void (* const callback)(const u8_t * const samples)) {
+    ERROR_t error = ERROR_OK;
+    u8_t u8_tSreg = 0;
+    s8_t i = -1;
+
+    if( (NULL == buffer) || (NULL == callback) ) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ADC_GetChannelIndex(channel, &i);
+    if( (ERROR_OK != error) || (i < 0) || (0 == length) || (length > 0x7FFF) ) {
+        return error | ERROR_INVALID_PARAMETER;
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+
+    if(ADC_MODE_SINGLE != ADC_Mode) {
+        SREG = u8_tSreg;
+        return ERROR_BUSY;
+    }
+    ADC_Mode = ADC_MODE_FAST;
+
+    SREG = u8_tSreg;
+
+    ADC_DisableInterrupt();
+
+    ADC_FastBuffer      = buffer;
+    ADC_FastLength      = length;
+    ADC_FastIndex       = 0;
+    ADC_FastHalves      = 0;
+    ADC_FastCallback    = callback;
+    ADC_FastSignFlip    = ADC_IS_DIFFERENTIAL(adcConfigs[i].adc) ? (ADC_SIGN_BIT >> 2) : 0;
+    ADC_FastIsSettling  = ADC_IS_DIFFERENTIAL(adcConfigs[i].adc) ? 1 : 0;
+
+    /*!< Left adjusted: ADCH holds the 8 MSBs, ADCL is not read */
+    ADC->ADMUX = ADC_ChannelAdmux[channel] | (1 << ADLAR);
+    ADC_CurrentChannel = NUM_OF_USED_ADC_CHANNELS;  /*!< ADC_Read() must select its channel again */
+
+    error |= ADC_SetPrescaler(ADC_FAST_CAPTURE_PRESCALER);
+    error |= ADC_ControlAutoTrigger(ADC_AUTO_TRIGGER_ON);       /*!< Free running */
+    error |= ADC_Enable();
+
+    if(ERROR_OK == error) {
+        ADC->ADCSRA |= (1 << ADIE) | (1 << ADSC);
+        GIE_Enable();
+    } else {
+        ADC_Mode = ADC_MODE_SINGLE;
+    }
+
+    return error;
+}
+
+ERROR_t ADC_StopFastCapture(void) {
+    if(ADC_MODE_FAST != ADC_Mode) {
+        return ERROR_OK;
+    }
+
+    BIT_CLR(ADC->ADCSRA, ADIE);
+    (void)ADC_ControlAutoTrigger(ADC_AUTO_TRIGGER_OFF);
+
+    while(BIT_IS_SET(ADC->ADCSRA, ADSC)) {
+        ADC_WAIT();     /*!< Wait for the conversion in progress, its result is dropped */
+    }
+    ADC_DisableInterrupt();
+    ADC_Mode = ADC_MODE_SINGLE;
+
+    return ERROR_OK;
+}
+
+ERROR_t ADC_GetFastCaptureCount(u32_t * const ptrToSamples) {
+    u8_t u8_tSreg = 0;
+
+    if(NULL == ptrToSamples) {
+        return ERROR_NULL_POINTER;
+    }
+
+    /*!< No fast capture was started: the length is still 0 */
+    if(0 == ADC_FastLength) {
+        *ptrToSamples = 0;
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+    *ptrToSamples = (ADC_FastHalves * ADC_FastLength) + (ADC_FastIndex % ADC_FastLength);
+    SREG = u8_tSreg;
+
+    return ERROR_OK;
+}
+
+ERROR_t ADC_GetCaptureStats(ADC_CAPTURE_STATS_t * const ptrToStats) {
+    u8_t u8_tSreg = 0;
+
+    if(NULL == ptrToStats) {
+        return ERROR_NULL_POINTER;
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+    *ptrToStats = ADC_CaptureStats;
+    SREG = u8_tSreg;
+
+    return ERROR_OK;
+}
+
+ERROR_t ADC_CalibratePoint(const ADC_CHANNEL_t channel, const ADC_CAL_POINT_t point, const u16_t expectedValue) {
+    ERROR_t error = ERROR_OK;
+    u16_t liveGain = 0;
+    s16_t liveOffset = 0;
+    u16_t raw = 0;
+    u32_t gain = 0;
+
+    if(channel >= NUM_OF_USED_ADC_CHANNELS) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    /*!< The ISRs must not use the coefficients while they change */
+    if(ADC_MODE_SINGLE != ADC_Mode) {
+        return ERROR_BUSY;
+    }
+
+    if( (ADC_CAL_POINT_HIGH == point) && !ADC_CalIsLowDone[channel] ) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    /*!< Bypass the correction for this read only: the live calibration is
+         kept until the high point succeeds, as the one in the EEPROM */
+    liveGain   = ADC_CalGains[channel];
+    liveOffset = ADC_CalOffsets[channel];
+    ADC_CalGains[channel]   = ADC_CAL_GAIN_ONE;
+    ADC_CalOffsets[channel] = 0;
+    error |= ADC_Read(channel, &raw);
+    ADC_CalGains[channel]   = liveGain;
+    ADC_CalOffsets[channel] = liveOffset;
+    if(ERROR_OK != error) {
+        return error;
+    }
+
+    switch(point) {
+        case ADC_CAL_POINT_LOW:
+            ADC_CalLowRaw[channel]      = raw;
+            ADC_CalLowExpected[channel] = expectedValue;
+            ADC_CalIsLowDone[channel]   = 1;
+            break;
+
+        case ADC_CAL_POINT_HIGH:
+            if( (raw <= ADC_CalLowRaw[channel]) || (expectedValue <= ADC_CalLowExpected[channel]) ) {
+                return ERROR_OUT_OF_RANGE;
+            }
+
+            gain = ((u32_t)(expectedValue - ADC_CalLowExpected[channel]) << 15) / (raw - ADC_CalLowRaw[channel]);
+            if(gain > 0xFFFF) {
+                return ERROR_OUT_OF_RANGE;
+            }
+
+            ADC_CalGains[channel]   = (u16_t)gain;
+            ADC_CalOffsets[channel] = (s16_t)((s32_t)ADC_CalLowExpected[channel] -
+                                              (s32_t)(((u32_t)ADC_CalLowRaw[channel] * gain) >> 15));
+            ADC_CalIsLowDone[channel] = 0;
+
+            error |= ADC_SaveCalibration(channel);
+            break;
+
+        default:
+            error |= ERROR_INVALID_PARAMETER;
+            break;
+    }
+
+    return error;
+}
+
+ERROR_t ADC_ClearCalibration(const ADC_CHANNEL_t channel) {
+    if(channel >= NUM_OF_USED_ADC_CHANNELS) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    if(ADC_MODE_SINGLE != ADC_Mode) {
+        return ERROR_BUSY;
+    }
+
+    ADC_CalGains[channel]     = ADC_CAL_GAIN_ONE;
+    ADC_CalOffsets[channel]   = 0;
+    ADC_CalIsLowDone[channel] = 0;
+
+    return ADC_SaveCalibration(channel);
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE FUNCTIONS                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**************************************************************************
+ * @brief  Select a channel: its ADMUX (reference, adjustment and input) is
+ *         written at once. The prescaler and the auto trigger are written
+ *         only if they change.
+ *************************************************************************/
+static ERROR_t ADC_InitChannel(const ADC_CHANNEL_t channel) {
+    ERROR_t error = ERROR_OK;
+    s8_t i = 0;
+    
+    /*!< Get the index of the channel in the array, -1 if not found */
+    error |= ADC_GetChannelIndex(channel, &i);
+
+    if(error || (i < 0)) {
+        if(i < 0) {
+            error |= ERROR_INVALID_PARAMETER;
+        }
+
+        return error;
+    }
+
+    /*!< Disable ADC interrupt */
+    ADC_DisableInterrupt();
+
+    ADC->ADMUX = ADC_ChannelAdmux[channel];
+    ADC_IsSettling = ADC_IS_DIFFERENTIAL(adcConfigs[i].adc) ? 1 : 0;
+
+    /*!< ADPS bits of ADC_PRESCALER_t n are n + 1 */
+    if( ((ADC->ADCSRA >> ADPS0) & 0x07) != (adcConfigs[i].prescaler + 1) ) {
+        error |= ADC_SetPrescaler(adcConfigs[i].prescaler);
+    }
+
+    if( (0 != BIT_IS_SET(ADC->ADCSRA, ADFR)) != (ADC_AUTO_TRIGGER_ON == adcConfigs[i].autoTrigger) ) {
+        error |= ADC_ControlAutoTrigger(adcConfigs[i].autoTrigger);
+    }
+
+    ADC_CurrentChannel = channel;
+
+    return error;
+}
+
+ERROR_t ADC_SetReferenceVoltage(const ADC_CHANNEL_t channel, const ADC_REFERENCE_t reference) {
+    ERROR_t error = ERROR_OK;
+    s8_t i = 0;
+
+    error |= ADC_GetChannelIndex(channel, &i);
+
+    if( (i >= 0) && (ASSERT_VALID_REFERENCE(reference)) ) {
+        adcConfigs[i].reference = reference;
+        ADC_ChannelAdmux[channel] = ADC_BuildAdmux(i);
+
+        if(ADC_CurrentChannel == channel) {
+            ADC->ADMUX = ADC_ChannelAdmux[channel];
+        }
+    } else {
+        error |= ERROR_INVALID_PARAMETER;
+    }
+
+    return error;
+}
+
+static ERROR_t ADC_ControlAutoTrigger(const ADC_AUTO_TRIGGER_t autoTrigger) {
+    ERROR_t error = ERROR_OK;
+    
+    switch(autoTrigger) {
+        case ADC_AUTO_TRIGGER_OFF:
+            BIT_CLR(ADC->ADCSRA, ADFR);
+            break;
+        case ADC_AUTO_TRIGGER_ON:
+            BIT_SET(ADC->ADCSRA, ADFR);
+            break;
+        default:
+            error |= ERROR_INVALID_PARAMETER;
+            break;
+    }
+
+    return error;
+}
+
+static ERROR_t ADC_SetPrescaler(ADC_PRESCALER_t prescaler) {
+    ERROR_t error = ERROR_OK;
+    u8_t prescalerOldValue = 0;
+
+    /*!< Get the old prescaler value, then clear the prescaler bits */
+    prescalerOldValue = (ADC->ADCSRA >> ADPS0) & 0x07;
+    ADC->ADCSRA &= ~(0x07 << ADPS0);
+
+    /*!< Set the new prescaler value */
+    switch(prescaler) {
+        case ADC_PRESCALER_2:
             ADC->ADCSRA |= (0x01 << ADPS0);
             break;
         case ADC_PRESCALER_4:
@@ -349,58 +1242,592 @@ static ERROR_t ADC_SetPrescaler(ADC_PRESCALER_t prescaler) {
     return error;
 }
 
+/**************************************************************************
+ * @brief  Index of a channel in adcConfigs, from the table built by
+ *         ADC_Init(). -1 if the channel is not configured.
+ *************************************************************************/
 static ERROR_t ADC_GetChannelIndex(const ADC_CHANNEL_t channel, s8_t * const index) {
-    u8_t i = 0;
-
     if(NULL == index) {
         return ERROR_NULL_POINTER;
+    }
+
+    if(channel < NUM_OF_USED_ADC_CHANNELS) {
+        *index = (s8_t)ADC_ChannelIndexes[channel] - 1;
     } else {
         *index = -1;
     }
 
-    for(i = 0; i < countChannelsConfigured; ++i) {
-        if(adcConfigs[i].channel == channel) {
-            *index = i;
+    return ERROR_OK;
+}
+
+static ERROR_t ADC_StartConversion(void) {  
+    BIT_SET(ADC->ADCSRA, ADSC);
+    return ERROR_OK;
+}
+
+/**************************************************************************
+ * @brief  Read the result of the last conversion as 10 bits, whatever the
+ *         adjustment is. ADCL must be read first: it locks ADCH.
+ *         The two's complement result of a differential input is returned
+ *         with an offset of 512 (sign bit inverted), so it stays unsigned.
+ *************************************************************************/
+static u16_t ADC_GetResult(void) {
+    const u8_t mux = ADC->ADMUX & ADC_MUX_MASK;
+    u16_t value = 0;
+
+    if(BIT_IS_SET(ADC->ADMUX, ADLAR)) {
+        value  = ( (ADC->ADCL) >> 6) & 0x3;
+        value |= (u16_t)(ADC->ADCH) << 2;
+    } else {
+        value  = (u8_t)(ADC->ADCL);
+        value |= ((u16_t)(ADC->ADCH) & 0x3) << 8;
+    }
+
+    if(ADC_IS_DIFFERENTIAL(mux)) {
+        value ^= ADC_SIGN_BIT;
+    }
+
+    return value;
+}
+
+/**************************************************************************
+ * @brief  Voltage of the reference of a configured channel in mV.
+ * @param[in]  index: Index of the channel in adcConfigs.
+ *************************************************************************/
+static u16_t ADC_GetReferenceMillivolts(const u8_t index) {
+    u16_t millivolts = 0;
+
+    switch(adcConfigs[index].reference) {
+        case ADC_REFERENCE_AVCC:
+            millivolts = ADC_AVCC_MILLIVOLTS;
             break;
+        case ADC_REFERENCE_INTERNAL:
+            millivolts = ADC_INTERNAL_MILLIVOLTS;
+            break;
+        default:        /*!< ADC_REFERENCE_AREF */
+            millivolts = ADC_AREF_MILLIVOLTS;
+            break;
+    }
+
+    return millivolts;
+}
+
+/**************************************************************************
+ * @brief  value * reference / 2^(10 + shift), rounded. 8191 * 5000 fits in
+ *         u32_t, and the division is a shift.
+ *************************************************************************/
+static u16_t ADC_ScaleMillivolts(const u16_t value, const u8_t shift, const u16_t referenceMillivolts) {
+    return (u16_t)( ( ((u32_t)value * referenceMillivolts) + (1UL << (9 + shift)) ) >> (10 + shift) );
+}
+
+/**************************************************************************
+ * @brief  Convert and drop a result: the first conversion after switching
+ *         to a differential input is not accurate while the offset
+ *         cancellation of the gain stage settles.
+ *************************************************************************/
+static void ADC_DropConversion(void) {
+    ADC_IsSettling = 0;
+
+    BIT_SET(ADC->ADCSRA, ADSC);
+    do {
+        ADC_WAIT();     /*!< Wait for conversion to finish */
+    } while(BIT_IS_CLEAR(ADC->ADCSRA, ADIF));
+    BIT_SET(ADC->ADCSRA, ADIF);
+}
+
+/**************************************************************************
+ * @brief  ADMUX value of a configured channel: reference, adjustment and
+ *         input.
+ * @param[in]  index: Index of the channel in adcConfigs.
+ *************************************************************************/
+static u8_t ADC_BuildAdmux(const u8_t index) {
+    u8_t admux = 0;
+
+    switch(adcConfigs[index].reference) {
+        case ADC_REFERENCE_AVCC:
+            admux |= (1 << REFS0);
+            break;
+        case ADC_REFERENCE_INTERNAL:
+            admux |= (1 << REFS1) | (1 << REFS0);
+            break;
+        default:        /*!< ADC_REFERENCE_AREF */
+            break;
+    }
+
+    if(ADC_ADJUST_LEFT == adcConfigs[index].adjust) {
+        admux |= (1 << ADLAR);
+    }
+
+    admux |= (adcConfigs[index].adc << MUX0);
+
+    return admux;
+}
+
+/**************************************************************************
+ * @brief  CPU cycles to get one result of a configured channel.
+ * @param[in]  index: Index of the channel in adcConfigs.
+ *************************************************************************/
+static u32_t ADC_GetConversionCycles(const u8_t index) {
+    return ADC_CYCLES_PER_CONVERSION(adcConfigs[index].prescaler) *
+           ADC_SAMPLES_PER_RESULT(adcConfigs[index].resolution);
+}
+
+/**************************************************************************
+ * @brief  Run the filters of a slot of the scan on a new result. Called
+ *         from the ISR, so only integer math is used.
+ * @param[in]  slot: Slot of the scan.
+ * @param[in]  value: New result.
+ * @return Filtered result.
+ *************************************************************************/
+static u16_t ADC_Filter(const u8_t slot, const u16_t value) {
+    ADC_FILTER_t * const filter = &ADC_Filters[slot];
+    const ADC_FILTER_CONFIGS_t * const config = filter->config;
+    u16_t sorted[ADC_MEDIAN_MAX_TAPS];
+    u16_t output = value;
+    u16_t temp = 0;
+    s32_t diff = 0;
+    u8_t length = 0;
+    u8_t i = 0;
+    u8_t j = 0;
+
+    if(NULL == config) {
+        return value;
+    }
+
+    /*!< Fill the windows with the first result: no start up ramp */
+    if(!filter->isPrimed) {
+        for(i = 0; i < ADC_MEDIAN_MAX_TAPS; ++i) {
+            filter->medianWindow[i] = value;
+        }
+        for(i = 0; i < ADC_BOXCAR_MAX_LENGTH; ++i) {
+            filter->boxcarWindow[i] = value;
         }
+        filter->medianIndex = 0;
+        filter->boxcarIndex = 0;
+        filter->boxcarSum   = (u16_t)(value << config->boxcar);
+        filter->emaQ15      = (s32_t)value << 15;
+        filter->isPrimed    = 1;
     }
 
-    return ERROR_OK;
+    if(ADC_MEDIAN_OFF != config->median) {
+        ADC_STAGE_BEGIN();
+        filter->medianWindow[filter->medianIndex] = output;
+        if(++filter->medianIndex >= config->median) {
+            filter->medianIndex = 0;
+        }
+
+        /*!< Insertion sort of a copy: 3 or 5 values */
+        for(i = 0; i < config->median; ++i) {
+            temp = filter->medianWindow[i];
+            for(j = i; (j > 0) && (sorted[j - 1] > temp); --j) {
+                sorted[j] = sorted[j - 1];
+            }
+            sorted[j] = temp;
+        }
+        output = sorted[config->median / 2];
+        ADC_STAGE_END(ADC_STAGE_MEDIAN);
+    }
+
+    if(ADC_BOXCAR_OFF != config->boxcar) {
+        ADC_STAGE_BEGIN();
+        length = (u8_t)(1U << config->boxcar);
+        filter->boxcarSum -= filter->boxcarWindow[filter->boxcarIndex];
+        filter->boxcarSum += output;
+        filter->boxcarWindow[filter->boxcarIndex] = output;
+        filter->boxcarIndex = (filter->boxcarIndex + 1) & (length - 1);
+        output = filter->boxcarSum >> config->boxcar;
+        ADC_STAGE_END(ADC_STAGE_BOXCAR);
+    }
+
+    if(0 != config->emaAlphaQ15) {
+        ADC_STAGE_BEGIN();
+        /*!< y += alpha * (x - y). The product is split in two 16 x 16 bits
+             multiplications, so it does not overflow s32_t. With 13 bits
+             results at most, diff >> 15 fits s16_t: the casts let the
+             compiler use its 16 x 16 -> 32 bits multiplications instead of
+             32 x 32 bits ones */
+        diff = ((s32_t)output << 15) - filter->emaQ15;
+        filter->emaQ15 += (s32_t)(s16_t)(diff >> 15) * config->emaAlphaQ15;
+        filter->emaQ15 += (s32_t)(((u32_t)(u16_t)(diff & 0x7FFF) * config->emaAlphaQ15) >> 15);
+        output = (u16_t)((filter->emaQ15 + (1L << 14)) >> 15);
+        ADC_STAGE_END(ADC_STAGE_EMA);
+    }
+
+    return output;
 }
 
-static ERROR_t ADC_StartConversion(void) {  
+/**************************************************************************
+ * @brief  Apply the calibration of a channel: one multiplication and one
+ *         addition, then the result is limited to the range of the channel.
+ * @param[in]  shift: Extra bits of the channel (ADC_RESOLUTION_t).
+ *************************************************************************/
+static u16_t ADC_Correct(const ADC_CHANNEL_t channel, const u16_t value, const u8_t shift) {
+    const s32_t max = (1024L << shift) - 1;
+    s32_t corrected = (s32_t)(((u32_t)value * ADC_CalGains[channel]) >> 15) + ADC_CalOffsets[channel];
+
+    if(corrected < 0) {
+        corrected = 0;
+    } else if(corrected > max) {
+        corrected = max;
+    } else {
+        /* Do nothing */
+    }
+
+    return (u16_t)corrected;
+}
+
+/**************************************************************************
+ * @brief  Load the calibration of all the channels from EEPROM. Channels
+ *         without a valid record are not corrected.
+ *************************************************************************/
+static void ADC_LoadCalibration(void) {
+    ADC_CAL_RECORD_t record;
+    u8_t i = 0;
+
+    for(i = 0; i < NUM_OF_USED_ADC_CHANNELS; ++i) {
+        ADC_CalGains[i]   = ADC_CAL_GAIN_ONE;
+        ADC_CalOffsets[i] = 0;
+
+        if( (ERROR_OK == EEPROM_Read(ADC_CAL_EEPROM_ADDRESS + (i * sizeof(record)), (u8_t *)&record, sizeof(record))) &&
+            (record.check == (u16_t)(record.gainQ15 ^ (u16_t)record.offset ^ ADC_CAL_CHECK_KEY)) ) {
+            ADC_CalGains[i]   = record.gainQ15;
+            ADC_CalOffsets[i] = record.offset;
+        }
+    }
+}
+
+static ERROR_t ADC_SaveCalibration(const ADC_CHANNEL_t channel) {
+    ADC_CAL_RECORD_t record;
+
+    record.gainQ15  = ADC_CalGains[channel];
+    record.offset   = ADC_CalOffsets[channel];
+    record.check    = (u16_t)(record.gainQ15 ^ (u16_t)record.offset ^ ADC_CAL_CHECK_KEY);
+
+    return EEPROM_Write(ADC_CAL_EEPROM_ADDRESS + (channel * sizeof(record)), (const u8_t *)&record, sizeof(record));
+}
+
+/**************************************************************************
+ * @brief  Check a new result of a slot against its window, and call the
+ *         window callback if the state changes. A result must come back
+ *         inside by more than the hysteresis to leave BELOW or ABOVE.
+ *************************************************************************/
+static void ADC_CheckWindow(const u8_t slot, const u16_t value) {
+    ADC_WINDOW_t * const window = &ADC_Windows[slot];
+    ADC_WINDOW_STATE_t state = window->state;
+    ADC_WINDOW_STATE_t previous = state;
+
+    if(NULL == window->config) {
+        return;
+    }
+
+    switch(state) {
+        case ADC_WINDOW_BELOW:
+            if(value > ((u32_t)window->low + window->config->hysteresis)) {
+                state = (value > window->high) ? ADC_WINDOW_ABOVE : ADC_WINDOW_INSIDE;
+            }
+            break;
+        case ADC_WINDOW_ABOVE:
+            if(((u32_t)value + window->config->hysteresis) < window->high) {
+                state = (value < window->low) ? ADC_WINDOW_BELOW : ADC_WINDOW_INSIDE;
+            }
+            break;
+        default:        /*!< ADC_WINDOW_INSIDE or ADC_WINDOW_UNKNOWN */
+            if(value < window->low) {
+                state = ADC_WINDOW_BELOW;
+            } else if(value > window->high) {
+                state = ADC_WINDOW_ABOVE;
+            } else {
+                state = ADC_WINDOW_INSIDE;
+            }
+            break;
+    }
+
+    if(state == previous) {
+        return;
+    }
+
+    window->state = state;
+
+    if(ADC_WINDOW_UNKNOWN != previous) {
+#if (ADC_HANDLERS_BINDING == BINDING_STATIC)
+        ADC_WindowHandler(adcScanChannels[slot], state);
+#else
+        if(NULL != ADC_WindowCallback) {
+            ADC_WindowCallback(adcScanChannels[slot], state);
+        }
+#endif
+    }
+}
+
+#if (ADC_SCAN_STATS)
+/**************************************************************************
+ * @brief  Add a result of a slot to its statistics window. The first
+ *         result of a window sets min and max.
+ *************************************************************************/
+static void ADC_UpdateStats(const u8_t slot, const u16_t value) {
+    ADC_STATS_SUMS_t * const stats = &ADC_Stats[slot];
+
+    if(0 == stats->samples) {
+        stats->min          = value;
+        stats->max          = value;
+        stats->sum          = 0;
+        stats->sumOfSquares = 0;
+    } else if(0xFFFF == stats->samples) {
+        return;         /*!< Full: the window waits for a reset */
+    } else if(value < stats->min) {
+        stats->min = value;
+    } else if(value > stats->max) {
+        stats->max = value;
+    } else {
+        /* Do nothing */
+    }
+
+    stats->sum          += value;
+    stats->sumOfSquares += (u32_t)value * value;
+    ++stats->samples;
+}
+
+/**************************************************************************
+ * @brief  Integer square root, rounded down (bit by bit, no division).
+ *************************************************************************/
+static u16_t ADC_Sqrt(u32_t value) {
+    u32_t root = 0;
+    u32_t bit = 1UL << 30;
+
+    while(bit > value) {
+        bit >>= 2;
+    }
+
+    while(0 != bit) {
+        if(value >= (root + bit)) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (u16_t)root;
+}
+#endif
+
+static void ADC_CallHandler(void) {
+#if (ADC_HANDLERS_BINDING == BINDING_STATIC)
+    ADC_Handler();
+#else
+    if(NULL != ADC_Callback) {
+        ADC_Callback();
+    }
+#endif
+}
+
+/**************************************************************************
+ * @brief  Store the result of the slot, and start the next slot at once:
+ *         the callback of the sweep runs while the next channel converts.
+ *************************************************************************/
+static void ADC_ScanConversionComplete(void) {
+    const u8_t slot = ADC_ScanIndex;
+    u16_t value = 0;
+    u8_t isSweepDone = 0;
+
+    if(ADC_ScanIsSettling) {
+        ADC_ScanIsSettling = 0;
+        BIT_SET(ADC->ADCSRA, ADSC);     /*!< First conversion of a differential input: dropped */
+        return;
+    }
+
+    ADC_ScanSum += ADC_GetResult();
+
+    /*!< Oversampling: convert the same slot again until its sum is complete */
+    if(--ADC_ScanSamplesLeft > 0) {
+        BIT_SET(ADC->ADCSRA, ADSC);
+        return;
+    }
+
+    value = ADC_Correct(adcScanChannels[slot], ADC_ScanSum >> ADC_ScanShift[slot], ADC_ScanShift[slot]);
+    ADC_ScanResults[slot] = ADC_Filter(slot, value);
+    ADC_ScanSum = 0;
+
+    if(++ADC_ScanIndex >= countScanChannelsConfigured) {
+        ADC_ScanIndex = 0;
+        ++ADC_ScanSequence;
+        isSweepDone = 1;
+    }
+
+    ADC_ScanSamplesLeft = ADC_SAMPLES_PER_RESULT(ADC_ScanShift[ADC_ScanIndex]);
+    ADC_ScanIsSettling = ADC_ScanSettle[ADC_ScanIndex];
+    ADC->ADMUX = ADC_ScanAdmux[ADC_ScanIndex];
     BIT_SET(ADC->ADCSRA, ADSC);
-    return ERROR_OK;
+
+    /*!< The statistics and the events run while the next slot converts */
+#if (ADC_SCAN_STATS)
+    ADC_UpdateStats(slot, value);
+#endif
+    ADC_CheckWindow(slot, ADC_ScanResults[slot]);
+
+    if(isSweepDone) {
+        ADC_CallHandler();
+    }
 }
 
 
+/**************************************************************************
+ * @brief  Sample of the fast capture: the ADC runs free, so only ADCH is
+ *         read and stored. Kept short: it runs every 13 ADC clocks.
+ *************************************************************************/
+static void ADC_FastConversionComplete(void) {
+    if(ADC_FastIsSettling) {
+        ADC_FastIsSettling = 0;     /*!< First conversion of a differential input */
+        return;
+    }
+
+    ADC_FastBuffer[ADC_FastIndex] = ADC->ADCH ^ ADC_FastSignFlip;
+
+    if(++ADC_FastIndex == ADC_FastLength) {
+        ++ADC_FastHalves;
+        ADC_FastCallback(&ADC_FastBuffer[0]);
+    } else if(ADC_FastIndex == (2 * ADC_FastLength)) {
+        ADC_FastIndex = 0;
+        ++ADC_FastHalves;
+        ADC_FastCallback(&ADC_FastBuffer[ADC_FastLength]);
+    } else {
+        /* Do nothing */
+    }
+}
+
+/**************************************************************************
+ * @brief  Conversion complete of an async read: store the result, start
+ *         the next read of the queue, then call the callback of the done
+ *         read, so the converter does not wait for it.
+ *************************************************************************/
+static void ADC_RequestConversionComplete(void) {
+    const ADC_REQUEST_t * const request = &ADC_Queue[ADC_QueueHead];
+    void (* callback)(void) = NULL;
+    u16_t value = 0;
+
+    if(ADC_AsyncIsSettling) {
+        ADC_AsyncIsSettling = 0;
+        BIT_SET(ADC->ADCSRA, ADSC);     /*!< First conversion of a differential input: dropped */
+        return;
+    }
+
+    ADC_AsyncSum += ADC_GetResult();
+
+    /*!< Oversampling: more conversions are needed for this result */
+    if(--ADC_AsyncSamplesLeft > 0) {
+        BIT_SET(ADC->ADCSRA, ADSC);
+        return;
+    }
+
+    value = ADC_Correct(request->channel, ADC_AsyncSum >> ADC_AsyncShift, ADC_AsyncShift);
+    *request->result = (0 != request->referenceMillivolts) ?
+                       ADC_ScaleMillivolts(value, ADC_AsyncShift, request->referenceMillivolts) : value;
+    callback = request->callback;
+
+    ADC_QueueHead = (ADC_QueueHead + 1) % ADC_QUEUE_LENGTH;
+    if(--ADC_QueueCount > 0) {
+        ADC_StartRequest();
+    } else {
+        ADC_DisableInterrupt();
+        ADC_Mode = ADC_MODE_SINGLE;
+    }
+
+#if (ADC_HANDLERS_BINDING == BINDING_STATIC)
+    (void)callback;
+    ADC_Handler();
+#else
+    if(NULL != callback) {
+        callback();
+    }
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                          CALLBACKS OF TIMER ISRs                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/**************************************************************************
+ * @brief  Sample of the paced capture: start the next conversion first, so
+ *         the sampling time depends only on the latency of this ISR, then
+ *         store the result of the previous conversion. The data registers
+ *         keep it until the new conversion is done.
+ *************************************************************************/
+static void ADC_CaptureCompare(void) {
+    const u16_t latency = TIMER1_GetTimerValue() - ADC_CaptureNextCompare;
+    const u8_t isDone = (0 != BIT_IS_SET(ADC->ADCSRA, ADIF));
+
+    /*!< Start the conversion and clear ADIF (written with 1) in one write */
+    ADC->ADCSRA |= (1 << ADSC) | (1 << ADIF);
+
+    ADC_CaptureNextCompare += ADC_CapturePeriod;
+    TIMER1_SetCompareValue(ADC_CaptureNextCompare, ADC_CAPTURE_TIMER_OC);
+
+    if(latency < ADC_CaptureStats.minLatencyTicks) {
+        ADC_CaptureStats.minLatencyTicks = latency;
+    }
+    if(latency > ADC_CaptureStats.maxLatencyTicks) {
+        ADC_CaptureStats.maxLatencyTicks = latency;
+    }
+
+    if(!ADC_CaptureIsConverting) {
+        ADC_CaptureIsConverting = 1;        /*!< First compare: no result yet */
+    } else if(!isDone) {
+        ++ADC_CaptureStats.overruns;        /*!< The conversion started by the last compare is not done */
+    } else if(ADC_CaptureIsSettling) {
+        ADC_CaptureIsSettling = 0;          /*!< First conversion of a differential input */
+    } else {
+        ADC_CaptureBuffer[ADC_CaptureIndex] = ADC_GetResult();
+        ++ADC_CaptureStats.samples;
+
+        if(++ADC_CaptureIndex == ADC_CaptureLength) {
+            ADC_CaptureCallback(&ADC_CaptureBuffer[0]);
+        } else if(ADC_CaptureIndex == (2 * ADC_CaptureLength)) {
+            ADC_CaptureIndex = 0;
+            ADC_CaptureCallback(&ADC_CaptureBuffer[ADC_CaptureLength]);
+        } else {
+            /* Do nothing */
+        }
+    }
+}
+
 /*----------------------------------------------------------------------------*/
 /*                                                                            */
 /*                                  ISR                                       */
 /*                                                                            */
 /*----------------------------------------------------------------------------*/
 
+#if (ADC_HANDLERS_BINDING == BINDING_STATIC)
+/*!< Bound at link time: the application overrides it */
+void ADC_Handler(void) __attribute__((weak));
+void ADC_Handler(void) {
+    /* No handler: the result is stored only */
+}
+
+void ADC_WindowHandler(const ADC_CHANNEL_t channel, const ADC_WINDOW_STATE_t state) __attribute__((weak));
+void ADC_WindowHandler(const ADC_CHANNEL_t channel, const ADC_WINDOW_STATE_t state) {
+    (void)channel;
+    (void)state;
+}
+#endif
+
 /*!< ADC Conversion Complete Interrupt */
 void __vector_21(void) __attribute__((signal));
 void __vector_21(void) {
     GIE_Disable();
-    
-    /*!< Disable the ADC interrupt */
-    ADC_DisableInterrupt();
 
-    if(NULL != ADC_AsyncResult) {
-        
-        if(BIT_IS_SET(ADC->ADMUX, ADLAR)) {
-            *ADC_AsyncResult  = ( (ADC->ADCL) >> 6) & 0x3;
-            *ADC_AsyncResult |= (u16_t)(ADC->ADCH) << 2;
-        } else {       
-            *ADC_AsyncResult  = (u8_t)(ADC->ADCL);
-            *ADC_AsyncResult |= ((u16_t)(ADC->ADCH) & 0x3) << 8;
-        }
-    }
-
-    if(NULL != ADC_Callback) {
-        ADC_Callback();
+    if(ADC_MODE_FAST == ADC_Mode) {
+        ADC_FastConversionComplete();       /*!< First: it has the shortest budget */
+    } else if(ADC_MODE_SCAN == ADC_Mode) {
+        ADC_ScanConversionComplete();
+    } else if(ADC_MODE_QUIET == ADC_Mode) {
+        ADC_QuietIsDone = 1;        /*!< The result is read by ADC_ReadQuiet() */
+    } else if(ADC_MODE_ASYNC == ADC_Mode) {
+        ADC_RequestConversionComplete();
+    } else {
+        ADC_DisableInterrupt();     /*!< Not expected */
     }
 
     GIE_Enable();
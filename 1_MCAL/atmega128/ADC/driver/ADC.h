@@ -17,8 +17,17 @@
 /*                                                                              */
 /*------------------------------------------------------------------------------*/
 
+/******************************************************************************
+ * @brief   Names of the used ADC channels. Change it to your needs, and
+ *          configure each channel in ADC_cfg.c
+ ******************************************************************************/
 typedef enum {
     ADC_CHANNEL_TEMP,
+    ADC_CHANNEL_POT,
+    ADC_CHANNEL_BATTERY,
+    ADC_CHANNEL_MOTOR_A_CURRENT,
+    ADC_CHANNEL_MOTOR_B_CURRENT,
+    NUM_OF_USED_ADC_CHANNELS
 } ADC_CHANNEL_t;
 
 typedef enum {
@@ -27,6 +36,62 @@ typedef enum {
     ADC_REFERENCE_INTERNAL,       /*!< Internal 2.56V Voltage Reference */
 } ADC_REFERENCE_t;
 
+/******************************************************************************
+ * @brief   Timing of the results of a channel, see \ref ADC_GetTiming.
+ ******************************************************************************/
+typedef struct {
+    u8_t    bits;                   /*!< Resolution of the results */
+    u8_t    conversionsPerResult;   /*!< 4^(bits - 10) */
+    u32_t   latencyUs;              /*!< Time to get one result */
+    u32_t   scanRateHz;             /*!< Results per second in the scan, 0 if not scanned */
+} ADC_TIMING_t;
+
+/******************************************************************************
+ * @brief   Position of the results of a channel against its window (see
+ *          adcWindowConfigs in ADC_cfg.c).
+ ******************************************************************************/
+typedef enum {
+    ADC_WINDOW_UNKNOWN,     /*!< No result yet */
+    ADC_WINDOW_BELOW,       /*!< Below low */
+    ADC_WINDOW_INSIDE,      /*!< Between low and high */
+    ADC_WINDOW_ABOVE,       /*!< Above high */
+} ADC_WINDOW_STATE_t;
+
+/******************************************************************************
+ * @brief   Statistics of a scanned channel, see \ref ADC_GetStats. The values
+ *          are in the resolution of the channel, after the calibration and
+ *          before the filters.
+ ******************************************************************************/
+typedef struct {
+    u16_t   min;
+    u16_t   max;
+    u16_t   peakToPeak;         /*!< max - min */
+    u16_t   mean;
+    u16_t   rms;                /*!< sqrt(mean of the squares), with the DC part */
+    u16_t   samples;            /*!< Results in the window, 0 if none: the other members are 0 */
+} ADC_STATS_t;
+
+/******************************************************************************
+ * @brief   Points of the two points calibration, see \ref ADC_CalibratePoint.
+ ******************************************************************************/
+typedef enum {
+    ADC_CAL_POINT_LOW,
+    ADC_CAL_POINT_HIGH,
+} ADC_CAL_POINT_t;
+
+/******************************************************************************
+ * @brief   Statistics of the paced capture, see \ref ADC_GetCaptureStats.
+ *          The latency is the time from the compare match of the timer to the
+ *          start of the conversion, in timer ticks. The jitter of the sampling
+ *          interval is (maxLatencyTicks - minLatencyTicks).
+ ******************************************************************************/
+typedef struct {
+    u16_t   minLatencyTicks;
+    u16_t   maxLatencyTicks;
+    u16_t   overruns;           /*!< Samples lost: the conversion was not done */
+    u32_t   samples;            /*!< Samples stored */
+} ADC_CAPTURE_STATS_t;
+
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
 /*                             API FUNCTIONS                                    */
@@ -36,10 +101,98 @@ typedef enum {
 /*******************************************************************************
  * @brief       Initialize ADC configurations based on user configurations in 
  *              ADC_cfg.h and ADC_cfg.c
+ * @note        Must be called before the other APIs: it builds the table of the
+ *              channels (index in adcConfigs and ADMUX value of each channel),
+ *              and loads the calibration of the channels from EEPROM.
  ******************************************************************************/
 ERROR_t ADC_Init(void);
+
+/*******************************************************************************
+ * @brief       Read a channel. The result has the resolution configured for the
+ *              channel (10 to 13 bits), right adjusted.
+ ******************************************************************************/
 ERROR_t ADC_Read(const ADC_CHANNEL_t channel, u16_t * const ptrToValue);
-ERROR_t ADC_ReadAsync(const ADC_CHANNEL_t channel, u16_t * const ptrToValue, void (* const ADC_Callback) (void));
+
+/*******************************************************************************
+ * @brief       Read a channel in ADC noise reduction sleep: the CPU and the I/O
+ *              clock are stopped during each conversion, so their switching
+ *              noise does not reach the ADC. The conversion complete interrupt
+ *              wakes the CPU.
+ * @param[in]   channel: See \ref ADC_CHANNEL_t.
+ * @param[out]  ptrToValue: Result with the resolution of the channel.
+ * @note        The noise gain depends on the board layout and the analog
+ *              supply: measure it on the target by comparing the spread of
+ *              ADC_Read() and ADC_ReadQuiet() results on a steady input.
+ *              Added latency: the wake up of the CPU and the ISR, a few tens
+ *              of cycles per conversion.
+ * @warning     TIMER1, TIMER2, TIMER3, the UARTs and SPI stop while sleeping:
+ *              their counters, PWM outputs and transfers are frozen for the
+ *              conversion time. Do not use it with SOFT_PWM, ICU or CPU_LOAD
+ *              running. See ADC_QUIET_MASK_WAKEUPS in ADC_cfg.h.
+ * @note        Global interrupts are enabled while sleeping, and restored after.
+ ******************************************************************************/
+ERROR_t ADC_ReadQuiet(const ADC_CHANNEL_t channel, u16_t * const ptrToValue);
+
+/*******************************************************************************
+ * @brief       Read a channel as a signed value: see ADC_ToSigned().
+ ******************************************************************************/
+ERROR_t ADC_ReadSigned(const ADC_CHANNEL_t channel, s16_t * const ptrToValue);
+
+/*******************************************************************************
+ * @brief       Convert a result of a channel (from ADC_Read(), the scan, the
+ *              capture...) to a signed value. For a differential input the
+ *              offset of half the range is removed: -512 to 511 in 10 bits,
+ *              -4096 to 4095 in 13 bits. Other inputs are not changed.
+ * @param[in]   channel: See \ref ADC_CHANNEL_t.
+ * @param[in]   value: Result with the resolution of the channel.
+ * @param[out]  ptrToSigned: Signed result.
+ * @note        The capture results are always 10 bits.
+ ******************************************************************************/
+ERROR_t ADC_ToSigned(const ADC_CHANNEL_t channel, const u16_t value, s16_t * const ptrToSigned);
+
+/*******************************************************************************
+ * @brief       Queue a read of a channel, without waiting. Each read has its
+ *              own destination and callback, so modules can read channels at
+ *              the same time: the ISR writes the result, starts the next read
+ *              of the queue, then calls the callback.
+ * @param[in]   channel: See \ref ADC_CHANNEL_t.
+ * @param[out]  ptrToValue: Written by the ISR with the resolution of the channel.
+ * @param[in]   callback: Called from the ISR when the result is written. NULL
+ *              if not needed.
+ * @return      ERROR_t: ERROR_BUSY if the queue is full (ADC_QUEUE_LENGTH in
+ *              ADC_cfg.h), or the scan or the capture runs.
+ * @note        ADC_Read(), ADC_StartScan() and ADC_StartCapture() return
+ *              ERROR_BUSY until the queue is empty.
+ * @note        Global interrupts are not changed: the ISR writes the result
+ *              and calls the callback only once GIE is enabled (GIE_Enable()).
+ ******************************************************************************/
+ERROR_t ADC_ReadAsync(const ADC_CHANNEL_t channel, u16_t * const ptrToValue, void (* const callback) (void));
+
+/*******************************************************************************
+ * @brief       Read the voltage of a single ended channel in mV, from the
+ *              reference of the channel (see ADC_AVCC_MILLIVOLTS in
+ *              ADC_cfg.h). Integer math only, rounded to the nearest mV.
+ * @param[in]   channel: See \ref ADC_CHANNEL_t.
+ * @param[out]  ptrToMillivolts: Voltage at the pin in mV.
+ * @return      ERROR_t: ERROR_INVALID_PARAMETER for a differential input (use
+ *              ADC_ReadSigned()), ERROR_BUSY if the scan or the capture runs.
+ ******************************************************************************/
+ERROR_t ADC_ReadMillivolts(const ADC_CHANNEL_t channel, u16_t * const ptrToMillivolts);
+
+/*******************************************************************************
+ * @brief       Same as ADC_ReadMillivolts(), without waiting: the read is
+ *              queued as ADC_ReadAsync(), and the ISR writes the voltage.
+ ******************************************************************************/
+ERROR_t ADC_ReadMillivoltsAsync(const ADC_CHANNEL_t channel, u16_t * const ptrToMillivolts, void (* const callback) (void));
+
+/*******************************************************************************
+ * @brief       Convert a result of a single ended channel (from the scan, for
+ *              example) to mV.
+ * @param[in]   channel: See \ref ADC_CHANNEL_t.
+ * @param[in]   value: Result with the resolution of the channel.
+ * @param[out]  ptrToMillivolts: Voltage at the pin in mV.
+ ******************************************************************************/
+ERROR_t ADC_ToMillivolts(const ADC_CHANNEL_t channel, const u16_t value, u16_t * const ptrToMillivolts);
 ERROR_t ADC_Enable(void);  
 ERROR_t ADC_Disable(void);  
 ERROR_t ADC_SetReferenceVoltage(const ADC_CHANNEL_t channel, const ADC_REFERENCE_t reference);
@@ -47,6 +200,200 @@ ERROR_t ADC_EnableInterrupt(void);
 ERROR_t ADC_DisableInterrupt(void);
 ERROR_t ADC_SetCallback(void (* const ptrToCallback)(void));
 
+/*******************************************************************************
+ * @brief       Start converting the channels of adcScanChannels (ADC_cfg.c) in
+ *              the background. The ISR stores each result in the slot of its
+ *              channel and starts the conversion of the next channel, so the
+ *              channels are converted one after the other without stopping.
+ * @param[in]   callback: Called from the ISR at the end of each sweep (all the
+ *              channels converted once). NULL if not needed.
+ * @return      ERROR_t:
+ *              - ERROR_BUSY if the scan or the capture is already running.
+ *              - ERROR_INVALID_PARAMETER if a channel is not configured, or the
+ *                channels do not use the same reference.
+ * @note        The prescaler of the first channel of the scan is used.
+ * @note        ADC_Read(), ADC_ReadAsync() and ADC_StartCapture() return
+ *              ERROR_BUSY while the scan is running.
+ * @note        Global interrupts are enabled by this function.
+ ******************************************************************************/
+ERROR_t ADC_StartScan(void (* const callback)(void));
+
+/*******************************************************************************
+ * @brief       Stop the scan after the conversion in progress.
+ ******************************************************************************/
+ERROR_t ADC_StopScan(void);
+
+/*******************************************************************************
+ * @brief       Get the last result of a channel of the scan, after the filters
+ *              of the channel (see adcFilterConfigs in ADC_cfg.c).
+ * @param[in]   channel: A channel of adcScanChannels.
+ * @param[out]  ptrToValue: Result with the resolution of the channel.
+ * @return      ERROR_t:
+ *              - ERROR_INVALID_PARAMETER if the channel is not in the scan.
+ *              - ERROR_NOT_INITIALIZED if no sweep is completed yet.
+ ******************************************************************************/
+ERROR_t ADC_GetScanResult(const ADC_CHANNEL_t channel, u16_t * const ptrToValue);
+
+/*******************************************************************************
+ * @brief       Get the number of completed sweeps since ADC_StartScan(). A new
+ *              value means that all the results of the scan are updated.
+ * @param[out]  ptrToSequence: Number of sweeps (wraps around).
+ ******************************************************************************/
+ERROR_t ADC_GetScanSequence(u16_t * const ptrToSequence);
+
+/*******************************************************************************
+ * @brief       Get the statistics of a scanned channel, over the results since
+ *              the start of the window: ADC_StartScan() or the last call with
+ *              isReset. The ISR only adds each result to the sums, the mean and
+ *              the RMS are computed here.
+ * @param[in]   channel: A channel of adcScanChannels.
+ * @param[out]  ptrToStats: See \ref ADC_STATS_t.
+ * @param[in]   isReset: 1 to start a new window after the read (in the same
+ *              critical section, so no result is lost), 0 to keep it.
+ * @note        A window stops at 65535 results: call it with isReset before.
+ ******************************************************************************/
+ERROR_t ADC_GetStats(const ADC_CHANNEL_t channel, ADC_STATS_t * const ptrToStats, const u8_t isReset);
+
+/*******************************************************************************
+ * @brief       Set the function called from the scan ISR when a channel with a
+ *              window (adcWindowConfigs in ADC_cfg.c) changes state. It is not
+ *              called for the first result of each channel: use
+ *              ADC_GetWindowState() to get the initial state.
+ * @param[in]   callback: NULL to disable the events.
+ ******************************************************************************/
+ERROR_t ADC_SetWindowCallback(void (* const callback)(const ADC_CHANNEL_t channel, const ADC_WINDOW_STATE_t state));
+
+/*******************************************************************************
+ * @brief       Change the thresholds of the window of a channel.
+ * @return      ERROR_t: ERROR_INVALID_PARAMETER if the channel has no window in
+ *              the scan, or low > high.
+ ******************************************************************************/
+ERROR_t ADC_SetWindowThresholds(const ADC_CHANNEL_t channel, const u16_t low, const u16_t high);
+
+/*******************************************************************************
+ * @brief       Get the state of the window of a channel of the scan.
+ * @param[out]  ptrToState: See \ref ADC_WINDOW_STATE_t.
+ ******************************************************************************/
+ERROR_t ADC_GetWindowState(const ADC_CHANNEL_t channel, ADC_WINDOW_STATE_t * const ptrToState);
+
+/*******************************************************************************
+ * @brief       Sample a channel at a fixed rate into a double buffer. A compare
+ *              match of TIMER1 (see ADC_CAPTURE_TIMER_xxx in ADC_cfg.h) reads
+ *              the result of the previous conversion and starts the next one,
+ *              so one ISR runs per sample.
+ * @param[in]   channel: See \ref ADC_CHANNEL_t. One conversion per sample: the
+ *              resolution of the channel is not used.
+ * @param[in]   sampleRateHz: Samples per second. The period must be longer than
+ *              a conversion (13 ADC clocks).
+ * @param[in]   buffer: 2 * length samples. The two halves are filled one after
+ *              the other.
+ * @param[in]   length: Samples in each half.
+ * @param[in]   callback: Called from the ISR with the half that is full. It must
+ *              be done with it before the other half is full (length samples).
+ * @return      ERROR_t:
+ *              - ERROR_BUSY if the ADC is used by the scan or another capture,
+ *                or TIMER1 is used with another clock or mode.
+ *              - ERROR_OUT_OF_RANGE if the rate is too high or too low.
+ * @note        Global interrupts are enabled by this function.
+ ******************************************************************************/
+ERROR_t ADC_StartCapture(const ADC_CHANNEL_t channel, const u32_t sampleRateHz,
+                         u16_t * const buffer, const u16_t length,
+                         void (* const callback)(const u16_t * const samples));
+
+/*******************************************************************************
+ * @brief       Stop the capture and release TIMER1.
+ ******************************************************************************/
+ERROR_t ADC_StopCapture(void);
+
+/*******************************************************************************
+ * @brief       Get the statistics of the capture since ADC_StartCapture().
+ * @param[out]  ptrToStats: See \ref ADC_CAPTURE_STATS_t.
+ ******************************************************************************/
+ERROR_t ADC_GetCaptureStats(ADC_CAPTURE_STATS_t * const ptrToStats);
+
+/*******************************************************************************
+ * @brief       Capture a channel at the highest rate, with 8 bits per sample:
+ *              the ADC runs free with ADC_FAST_CAPTURE_PRESCALER (ADC_cfg.h),
+ *              left adjusted, and the ISR stores ADCH only.
+ * @param[in]   channel: See \ref ADC_CHANNEL_t. Its prescaler, adjustment and
+ *              resolution are not used.
+ * @param[out]  buffer: 2 * length bytes, filled in turn as 2 halves.
+ * @param[in]   length: Samples per half.
+ * @param[in]   callback: Called from the ISR when a half is full, with the
+ *              half. It must return before the next sample.
+ * @return      ERROR_t: ERROR_BUSY if the converter is used.
+ * @note        For a differential input the samples have an offset of 128.
+ * @note        The ADC interrupt runs for each sample: keep the other ISRs
+ *              short, a late ISR loses the sample (it is not counted).
+ * @note        Global interrupts are enabled by this function.
+ ******************************************************************************/
+ERROR_t ADC_StartFastCapture(const ADC_CHANNEL_t channel, u8_t * const buffer, const u16_t length,
+                             void (* const callback)(const u8_t * const samples));
+
+/*******************************************************************************
+ * @brief       Stop the fast capture.
+ ******************************************************************************/
+ERROR_t ADC_StopFastCapture(void);
+
+/*******************************************************************************
+ * @brief       Get the number of samples stored since ADC_StartFastCapture().
+ *              Read it twice with a known time between to measure the
+ *              throughput on the target.
+ * @param[out]  ptrToSamples: Samples stored.
+ * @return      ERROR_t: ERROR_NOT_INITIALIZED (and 0 samples) if no fast
+ *              capture was started.
+ ******************************************************************************/
+ERROR_t ADC_GetFastCaptureCount(u32_t * const ptrToSamples);
+
+/*******************************************************************************
+ * @brief       Two points calibration of a channel. Apply a known input to the
+ *              channel, then call it with the value the ADC should return for
+ *              it: first for ADC_CAL_POINT_LOW, then for ADC_CAL_POINT_HIGH.
+ *              The gain (Q15) and the offset are computed at the high point,
+ *              stored in EEPROM and applied to all the later results:
+ *              result = ((raw * gain) >> 15) + offset
+ * @param[in]   channel: See \ref ADC_CHANNEL_t.
+ * @param[in]   point: See \ref ADC_CAL_POINT_t.
+ * @param[in]   expectedValue: Ideal result for the input, with the resolution
+ *              of the channel.
+ * @return      ERROR_t:
+ *              - ERROR_BUSY if the scan or the capture is running.
+ *              - ERROR_NOT_INITIALIZED if the high point is given before the
+ *                low point.
+ *              - ERROR_OUT_OF_RANGE if the gain is not in [0, 2), or the low
+ *                point is not below the high point.
+ * @note        The raw results are read without correction. The previous
+ *              calibration stays applied until the high point succeeds, and
+ *              is kept if a point fails.
+ * @note        Blocking: it writes the EEPROM (about 50 ms).
+ ******************************************************************************/
+ERROR_t ADC_CalibratePoint(const ADC_CHANNEL_t channel, const ADC_CAL_POINT_t point, const u16_t expectedValue);
+
+/*******************************************************************************
+ * @brief       Remove the calibration of a channel, in RAM and in EEPROM.
+ ******************************************************************************/
+ERROR_t ADC_ClearCalibration(const ADC_CHANNEL_t channel);
+
+/*******************************************************************************
+ * @brief       Get the resolution, latency and scan rate of a channel, computed
+ *              from its configuration and F_CPU.
+ * @param[in]   channel: See \ref ADC_CHANNEL_t.
+ * @param[out]  ptrToTiming: See \ref ADC_TIMING_t.
+ ******************************************************************************/
+ERROR_t ADC_GetTiming(const ADC_CHANNEL_t channel, ADC_TIMING_t * const ptrToTiming);
+
+/******************************************************************************
+ * @brief   Called by the conversion complete ISR instead of the callback when
+ *          ADC_HANDLERS_BINDING is BINDING_STATIC (see ADC_cfg.h). It is weak
+ *          and empty in ADC.c.
+ *****************************************************************************/
+void ADC_Handler(void);
 
+/******************************************************************************
+ * @brief   Called by the scan ISR instead of the window callback when
+ *          ADC_HANDLERS_BINDING is BINDING_STATIC. It is weak and empty in
+ *          ADC.c.
+ *****************************************************************************/
+void ADC_WindowHandler(const ADC_CHANNEL_t channel, const ADC_WINDOW_STATE_t state);
 
 #endif      /* ADC_H */
\ No newline at end of file
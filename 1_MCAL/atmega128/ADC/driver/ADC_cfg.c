@@ -20,16 +20,69 @@
  * @brief   Configuration of the ADC channels.
  * @details This array contains the configuration of the used ADC channels.
  *          Configurations are:
- *          - ADC_t name: The name of the ADC channel.
+ *          - ADC_t name: The input of the ADC. For a shunt, a differential
+ *            input with gain avoids an external amplifier, example:
+ *            {ADC_CHANNEL_MOTOR_A_CURRENT, ADC_DIFF_3_2_X10, ...}
  *          - ADC_PRESCALER_t prescaler: The prescaler of the ADC. The ADC 
  *            freqquency is: fADC = fCLK / prescaler. And it must be
  *            between 50kHz and 200kHz.
  *          - ADC_REF_t reference: The reference voltage of the ADC.
  *          - ADC_AUTO_TRIGGER_t autoTrigger: The auto trigger of the ADC.
  *          - ADC_ADJUST_t adjust: The adjust of the ADC.
+ *          - ADC_RESOLUTION_t resolution: 10 to 13 bits. More bits need more
+ *            conversions per result (see \ref ADC_GetTiming).
  ******************************************************************************/
 ADC_CONFIGS_t  adcConfigs[] = {
-    {ADC_CHANNEL_TEMP, ADC_0, ADC_PRESCALER_128, ADC_REFERENCE_AVCC, ADC_AUTO_TRIGGER_OFF, ADC_ADJUST_LEFT},
+    {ADC_CHANNEL_TEMP,              ADC_0, ADC_PRESCALER_128, ADC_REFERENCE_AVCC, ADC_AUTO_TRIGGER_OFF, ADC_ADJUST_LEFT,  ADC_RESOLUTION_12_BITS},
+    {ADC_CHANNEL_POT,               ADC_1, ADC_PRESCALER_128, ADC_REFERENCE_AVCC, ADC_AUTO_TRIGGER_OFF, ADC_ADJUST_RIGHT, ADC_RESOLUTION_10_BITS},
+    {ADC_CHANNEL_BATTERY,           ADC_2, ADC_PRESCALER_128, ADC_REFERENCE_AVCC, ADC_AUTO_TRIGGER_OFF, ADC_ADJUST_RIGHT, ADC_RESOLUTION_12_BITS},
+    {ADC_CHANNEL_MOTOR_A_CURRENT,   ADC_3, ADC_PRESCALER_128, ADC_REFERENCE_AVCC, ADC_AUTO_TRIGGER_OFF, ADC_ADJUST_RIGHT, ADC_RESOLUTION_10_BITS},
+    {ADC_CHANNEL_MOTOR_B_CURRENT,   ADC_4, ADC_PRESCALER_128, ADC_REFERENCE_AVCC, ADC_AUTO_TRIGGER_OFF, ADC_ADJUST_RIGHT, ADC_RESOLUTION_10_BITS},
+};
+
+/******************************************************************************
+ * @brief   Channels converted by ADC_StartScan(), in this order.
+ * @details A conversion takes 13 ADC clocks, so a sweep takes
+ *          (13 * prescaler / F_CPU) * conversions of all the channels, see
+ *          \ref ADC_GetTiming.
+ * @note    The channels must use the same reference.
+ ******************************************************************************/
+const ADC_CHANNEL_t adcScanChannels[] = {
+    ADC_CHANNEL_TEMP,
+    ADC_CHANNEL_POT,
+    ADC_CHANNEL_BATTERY,
+    ADC_CHANNEL_MOTOR_A_CURRENT,
+    ADC_CHANNEL_MOTOR_B_CURRENT,
+};
+
+/******************************************************************************
+ * @brief   Filters of the scanned channels, run in the ISR on each result.
+ *          ADC_GetScanResult() returns the filtered value. Channels that are
+ *          not listed are not filtered.
+ * @details Cost per result, mean of each stage timed by host/ADC_bench.c
+ *          (5 runs on an x86 host, the channels below). Host ns: use them to
+ *          compare the stages, not as AVR cycles:
+ *          - median (3 and 5 taps): 40 to 60 ns, sort of a copy of the window.
+ *          - boxcar: 9 to 16 ns, one add, one subtract and one shift.
+ *          - EMA: 8 to 16 ns, two 16 x 16 bits multiplications.
+ ******************************************************************************/
+const ADC_FILTER_CONFIGS_t adcFilterConfigs[] = {
+    {ADC_CHANNEL_TEMP,              ADC_MEDIAN_OFF, ADC_BOXCAR_OFF, ADC_EMA_ALPHA_Q15(0.0625)},
+    {ADC_CHANNEL_POT,               ADC_MEDIAN_3,   ADC_BOXCAR_4,   0},
+    {ADC_CHANNEL_BATTERY,           ADC_MEDIAN_OFF, ADC_BOXCAR_8,   0},
+    {ADC_CHANNEL_MOTOR_A_CURRENT,   ADC_MEDIAN_5,   ADC_BOXCAR_OFF, 0},
+    {ADC_CHANNEL_MOTOR_B_CURRENT,   ADC_MEDIAN_5,   ADC_BOXCAR_OFF, 0},
+};
+
+/******************************************************************************
+ * @brief   Windows of the scanned channels, checked in the ISR on each result.
+ *          The callback set by ADC_SetWindowCallback() is called when a
+ *          channel moves from a state to another (see ADC_WINDOW_STATE_t).
+ ******************************************************************************/
+const ADC_WINDOW_CONFIGS_t adcWindowConfigs[] = {
+    {ADC_CHANNEL_BATTERY,           2800,   4095,   40},    /*!< Under voltage (12 bits) */
+    {ADC_CHANNEL_MOTOR_A_CURRENT,   0,      800,    20},    /*!< Over current */
+    {ADC_CHANNEL_MOTOR_B_CURRENT,   0,      800,    20},    /*!< Over current */
 };
 
 
@@ -46,3 +99,17 @@ ADC_CONFIGS_t  adcConfigs[] = {
  ******************************************************************************/
 const u8_t countChannelsConfigured = sizeof(adcConfigs) / sizeof(adcConfigs[0]);
 
+/******************************************************************************
+ * @brief   Number of channels in the \ref adcScanChannels array.
+ ******************************************************************************/
+const u8_t countScanChannelsConfigured = sizeof(adcScanChannels) / sizeof(adcScanChannels[0]);
+
+/******************************************************************************
+ * @brief   Number of elements in the \ref adcFilterConfigs array.
+ ******************************************************************************/
+const u8_t countFiltersConfigured = sizeof(adcFilterConfigs) / sizeof(adcFilterConfigs[0]);
+
+/******************************************************************************
+ * @brief   Number of elements in the \ref adcWindowConfigs array.
+ ******************************************************************************/
+const u8_t countWindowsConfigured = sizeof(adcWindowConfigs) / sizeof(adcWindowConfigs[0]);
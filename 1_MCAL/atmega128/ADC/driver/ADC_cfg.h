@@ -9,6 +9,91 @@
 #ifndef ADC_CFG_H
 #define ADC_CFG_H
 
+#include "BINDING.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief Who is called by the conversion complete ISR when the result is
+ *        stored (see BINDING.h).
+ *        Options are:
+ *          BINDING_RUNTIME --> the callbacks passed to the ADC APIs
+ *          BINDING_STATIC  --> ADC_Handler() (see ADC.h)
+ *****************************************************************************/
+#define ADC_HANDLERS_BINDING      BINDING_RUNTIME
+
+/******************************************************************************
+ * @brief   Timer of the paced capture (\ref ADC_StartCapture). It uses one
+ *          compare channel of TIMER1 in normal mode, so the counter can be
+ *          shared with the ICU and SOFT_PWM if they use the same clock.
+ *          ADC_CAPTURE_TIMER_PRESCALER must match ADC_CAPTURE_TIMER_CLOCK.
+ ******************************************************************************/
+#define ADC_CAPTURE_TIMER_CLOCK         F_CPU_8
+#define ADC_CAPTURE_TIMER_PRESCALER     (8UL)
+#define ADC_CAPTURE_TIMER_OC            TIMER_OCA
+
+/******************************************************************************
+ * @brief   Prescaler of the 8 bits fast capture (\ref ADC_StartFastCapture).
+ *          The ADC runs free: F_CPU / (13 * prescaler) samples per second.
+ *          With F_CPU = 8 MHz:
+ *          ADC_PRESCALER_32 --> 19.2 kS/s
+ *          ADC_PRESCALER_16 --> 38.4 kS/s  (ADC clock 500 kHz)
+ *          ADC_PRESCALER_8  --> 76.9 kS/s  (ADC clock 1 MHz, 104 CPU cycles
+ *                               per sample for the ISR and the application)
+ * @note    Above 200 kHz the ADC clock gives less than 10 bits, so only the 8
+ *          bits of ADCH are used.
+ ******************************************************************************/
+#define ADC_FAST_CAPTURE_PRESCALER      ADC_PRESCALER_16
+
+/******************************************************************************
+ * @brief   Interrupts during \ref ADC_ReadQuiet. In ADC noise reduction sleep
+ *          only INT7:0 and TIMER0 (asynchronous clock) can wake the CPU before
+ *          the conversion is done, and each wake up adds noise.
+ *          Options are:
+ *          1 --> EIMSK and the TIMER0 interrupts are masked while sleeping,
+ *                and restored after. Their flags stay pending, so the events
+ *                are handled late, not lost (except level interrupts).
+ *          0 --> They are kept: the CPU sleeps again after each of them.
+ ******************************************************************************/
+#define ADC_QUIET_MASK_WAKEUPS          (1)
+
+/******************************************************************************
+ * @brief   Async reads (\ref ADC_ReadAsync) waiting for the converter. Each
+ *          one takes 7 bytes of RAM. A read returns ERROR_BUSY when the queue
+ *          is full.
+ ******************************************************************************/
+#define ADC_QUEUE_LENGTH                (8U)
+
+/******************************************************************************
+ * @brief   Voltages of the AVCC and AREF references in mV, used by
+ *          \ref ADC_ReadMillivolts. The internal reference is 2560 mV. Measure
+ *          them on the board: an error of the reference is an error of the
+ *          same ratio on all the results (or use ADC_CalibratePoint()).
+ ******************************************************************************/
+#define ADC_AVCC_MILLIVOLTS             (5000U)
+#define ADC_AREF_MILLIVOLTS             (5000U)
+
+/******************************************************************************
+ * @brief   EEPROM address of the calibration of the channels
+ *          (\ref ADC_CalibratePoint): 6 bytes per channel of ADC_CHANNEL_t.
+ ******************************************************************************/
+#define ADC_CAL_EEPROM_ADDRESS          (0x0000U)
+
+/******************************************************************************
+ * @brief   Statistics of the scanned channels (\ref ADC_GetStats).
+ *          Options are:
+ *          1 --> min, max, sum and sum of squares of each slot are updated in
+ *                the scan ISR: 18 bytes of RAM per slot, and a 16 x 16 bits
+ *                multiplication per result.
+ *          0 --> Not compiled.
+ ******************************************************************************/
+#define ADC_SCAN_STATS                  (1)
+
+
 /*----------------------------------------------------------------------------*/
 /*                                                                            */
 /*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
@@ -17,6 +102,18 @@
 
 typedef void (*ADC_CALLBACK_t)(void);
 
+/******************************************************************************
+ * @brief   Inputs of the ADC, in the order of the MUX4:0 bits.
+ *          ADC_DIFF_p_n_Xg: differential input ADCp - ADCn with a gain of g.
+ * @note    The results of the differential inputs are signed (-512 to 511 in
+ *          10 bits). ADC_Read() and the other APIs return them with an offset
+ *          of half the range (0 V = 512 in 10 bits), so the oversampling, the
+ *          filters and the calibration work on them as on the other inputs.
+ *          Use ADC_ToSigned() or ADC_ReadSigned() to remove the offset.
+ * @note    The gain stage is made for a bandwidth of about 4 kHz, and the
+ *          first conversion after switching to a differential input is
+ *          dropped by the driver (offset cancellation settling).
+ ******************************************************************************/
 typedef enum {
     ADC_0,
     ADC_1,
@@ -26,6 +123,28 @@ typedef enum {
     ADC_5,
     ADC_6,
     ADC_7,
+    ADC_DIFF_0_0_X10,       /*!< Offset of the 10x gain stage */
+    ADC_DIFF_1_0_X10,
+    ADC_DIFF_0_0_X200,      /*!< Offset of the 200x gain stage */
+    ADC_DIFF_1_0_X200,
+    ADC_DIFF_2_2_X10,       /*!< Offset of the 10x gain stage */
+    ADC_DIFF_3_2_X10,
+    ADC_DIFF_2_2_X200,      /*!< Offset of the 200x gain stage */
+    ADC_DIFF_3_2_X200,
+    ADC_DIFF_0_1_X1,
+    ADC_DIFF_1_1_X1,        /*!< Offset of the 1x gain stage */
+    ADC_DIFF_2_1_X1,
+    ADC_DIFF_3_1_X1,
+    ADC_DIFF_4_1_X1,
+    ADC_DIFF_5_1_X1,
+    ADC_DIFF_6_1_X1,
+    ADC_DIFF_7_1_X1,
+    ADC_DIFF_0_2_X1,
+    ADC_DIFF_1_2_X1,
+    ADC_DIFF_2_2_X1,        /*!< Offset of the 1x gain stage */
+    ADC_DIFF_3_2_X1,
+    ADC_DIFF_4_2_X1,
+    ADC_DIFF_5_2_X1,
     NUM_OF_ADC_CHANNELS
 } ADC_t;
 
@@ -49,16 +168,94 @@ typedef enum {
     ADC_ADJUST_LEFT,        /*!< Left adjust result */
 } ADC_ADJUST_t;
 
+/******************************************************************************
+ * @brief   Resolution of the results of a channel. Each extra bit n costs 4^n
+ *          conversions: they are summed and the sum is shifted right by n.
+ * @note    It works only if the input has at least 1 LSB of noise, otherwise
+ *          all the conversions give the same value.
+ ******************************************************************************/
+typedef enum {
+    ADC_RESOLUTION_10_BITS,     /*!< 1 conversion per result */
+    ADC_RESOLUTION_11_BITS,     /*!< 4 conversions per result */
+    ADC_RESOLUTION_12_BITS,     /*!< 16 conversions per result */
+    ADC_RESOLUTION_13_BITS,     /*!< 64 conversions per result */
+} ADC_RESOLUTION_t;
+
+ 
+/******************************************************************************
+ * @brief   Median filter: median of the last 3 or 5 results. Removes spikes.
+ ******************************************************************************/
+typedef enum {
+    ADC_MEDIAN_OFF  = 0,
+    ADC_MEDIAN_3    = 3,
+    ADC_MEDIAN_5    = 5,
+} ADC_MEDIAN_t;
+
+/******************************************************************************
+ * @brief   Boxcar filter: mean of the last 2^n results.
+ ******************************************************************************/
+typedef enum {
+    ADC_BOXCAR_OFF,
+    ADC_BOXCAR_2,
+    ADC_BOXCAR_4,
+    ADC_BOXCAR_8,
+} ADC_BOXCAR_t;
+
+#define ADC_MEDIAN_MAX_TAPS     (5)
+#define ADC_BOXCAR_MAX_LENGTH   (1 << ADC_BOXCAR_8)     /*!< 8 * 8191 (13 bits) fits in u16_t */
+
+/******************************************************************************
+ * @brief   Coefficient of the EMA filter in Q15 from a constant in [0, 1).
+ *          Example: ADC_EMA_ALPHA_Q15(0.125) --> 4096
+ ******************************************************************************/
+#define ADC_EMA_ALPHA_Q15(alpha)    ((u16_t)((alpha) * 32768.0 + 0.5))
+
+/******************************************************************************
+ * @brief   This struct is used to pass the filters of a scanned channel to the
+ *          APIs of the ADC module. The stages run in this order, in the ISR:
+ *          median --> boxcar --> EMA.
+ * @note    Members:
+ *          - ADC_CHANNEL_t channel: A channel of adcScanChannels.
+ *          - ADC_MEDIAN_t median: Median filter.
+ *          - ADC_BOXCAR_t boxcar: Moving average.
+ *          - u16_t emaAlphaQ15: y += alpha * (x - y), 0 to disable it.
+ *****************************************************************************/
+typedef struct {
+    ADC_CHANNEL_t   channel;
+    ADC_MEDIAN_t    median;
+    ADC_BOXCAR_t    boxcar;
+    u16_t           emaAlphaQ15;
+} ADC_FILTER_CONFIGS_t;
+
+/******************************************************************************
+ * @brief   This struct is used to pass the window of a scanned channel to the
+ *          APIs of the ADC module. See \ref ADC_WINDOW_STATE_t.
+ * @note    Members:
+ *          - ADC_CHANNEL_t channel: A channel of adcScanChannels.
+ *          - u16_t low: Results below it are ADC_WINDOW_BELOW.
+ *          - u16_t high: Results above it are ADC_WINDOW_ABOVE.
+ *          - u16_t hysteresis: A result must come back inside the window by
+ *            more than it to leave ADC_WINDOW_BELOW or ADC_WINDOW_ABOVE.
+ *          The values are in the resolution of the channel, after the
+ *          calibration and the filters.
+ *****************************************************************************/
+typedef struct {
+    ADC_CHANNEL_t   channel;
+    u16_t           low;
+    u16_t           high;
+    u16_t           hysteresis;
+} ADC_WINDOW_CONFIGS_t;
 
 /******************************************************************************
  * @brief   This struct is used to pass the configuration of a channel to the 
  *          APIs of the ADC module.
  * @note    Members:
- *          - ADC_t name: The name of the ADC channel.
+ *          - ADC_t name: The input of the ADC, single ended or differential.
  *          - ADC_PRESCALER_t prescaler: The prescaler of the ADC.
  *          - ADC_REF_t reference: The reference voltage of the ADC.
  *          - ADC_AUTO_TRIGGER_t autoTrigger: The auto trigger of the ADC.
  *          - ADC_ADJUST_t adjust: The adjust of the ADC.
+ *          - ADC_RESOLUTION_t resolution: Bits of the results (oversampling).
  *****************************************************************************/
 typedef struct{
     ADC_CHANNEL_t       channel;
@@ -67,6 +264,7 @@ typedef struct{
     ADC_REFERENCE_t     reference;
     ADC_AUTO_TRIGGER_t  autoTrigger;
     ADC_ADJUST_t        adjust;
+    ADC_RESOLUTION_t    resolution;
 } ADC_CONFIGS_t;
 
 /********************************************************************************
@@ -76,4 +274,13 @@ typedef struct{
 extern ADC_CONFIGS_t  adcConfigs[];
 extern const u8_t countChannelsConfigured;
 
+extern const ADC_CHANNEL_t adcScanChannels[];
+extern const u8_t countScanChannelsConfigured;
+
+extern const ADC_FILTER_CONFIGS_t adcFilterConfigs[];
+extern const u8_t countFiltersConfigured;
+
+extern const ADC_WINDOW_CONFIGS_t adcWindowConfigs[];
+extern const u8_t countWindowsConfigured;
+
 #endif    /* ADC_CFG_H */
\ No newline at end of file
@@ -24,10 +24,68 @@ typedef struct {
     u8_t ADMUX;
 } ADC_REG_t;
 
+#if defined(ADC_HOST)
+
+/*!< Host build (see ADC/host): the registers are variables of ADC_host.c,
+     and the waits run the simulated converter */
+extern volatile ADC_REG_t ADC_HostRegisters;
+extern volatile u8_t ADC_HostSreg;
+extern volatile u8_t ADC_HostMcucr;
+extern volatile u8_t ADC_HostEimsk;
+extern volatile u8_t ADC_HostTimsk;
+void ADC_HostIdle(void);
+
+#define ADC         (&ADC_HostRegisters)
+#define SREG        ADC_HostSreg
+#define MCUCR       ADC_HostMcucr
+#define EIMSK       ADC_HostEimsk
+#define ADC_TIMSK   ADC_HostTimsk
+#define I_BIT       (7U)
+
+#define ADC_WAIT()  ADC_HostIdle()
+#define ADC_SLEEP() ADC_HostIdle()
+
+/*!< Stages of the scan filters, timed by ADC_host.c (see ADC_HostGetStageStats) */
+#define ADC_STAGE_MEDIAN    (0U)
+#define ADC_STAGE_BOXCAR    (1U)
+#define ADC_STAGE_EMA       (2U)
+void ADC_HostStageBegin(void);
+void ADC_HostStageEnd(const u8_t stage);
+
+#define ADC_STAGE_BEGIN()       ADC_HostStageBegin()
+#define ADC_STAGE_END(stage)    ADC_HostStageEnd(stage)
+
+#else
+
 volatile ADC_REG_t * ADC = (ADC_REG_t *)0x24;
 #define SREG    (*(volatile u8_t *)0x5F)
 #define I_BIT   (7U)
 
+/*!< Sleep control and the interrupts that can wake the CPU from ADC noise
+     reduction sleep (same definitions as EXTI_reg.h and TIMER_reg.h) */
+#define MCUCR      (* ((volatile u8_t *) 0x55) )
+#define EIMSK      (* ((volatile u8_t *) 0x59) )
+#define ADC_TIMSK  (* ((volatile u8_t *) 0x57) )
+
+/*!< Body of the busy waits: nothing on the target */
+#define ADC_WAIT()
+
+/*!< Enter the sleep mode selected in MCUCR */
+#define ADC_SLEEP()     __asm__ __volatile__ ("sleep")
+
+/*!< Timing of the filter stages: nothing on the target */
+#define ADC_STAGE_BEGIN()
+#define ADC_STAGE_END(stage)
+
+#endif
+
+#define SLEEP_SM2   (2U)
+#define SLEEP_SM0   (3U)
+#define SLEEP_SM1   (4U)
+#define SLEEP_SE    (5U)
+#define TIMSK_TOIE0 (0U)
+#define TIMSK_OCIE0 (1U)
+
 enum {
     MUX0,
     MUX1,
@@ -0,0 +1,203 @@
+/******************************************************************************
+ * @file        ADC_bench.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Run the scan of \ref ADC.c on the simulated ADC and print the
+ *              accuracy of the filtered results and the time spent in the ISR
+ *              and in each stage of the filters.
+ * @details     Usage: adc_bench [-s seconds] ADCn=file[,rateHz] [REFn=file[,rateHz]] ...
+ *              - ADCn=file: waveform of the pin ADC_n (see ADC_HostWaveLoad()).
+ *              - REFn=file: waveform expected on ADC_n without noise. The
+ *                filtered scan results of the channels of ADC_n are compared
+ *                with it after each sweep. Default: the ADCn waveform.
+ *              The rate is 1000 Hz if not given.
+ *
+ *              The channels, filters and windows are the ones of ADC_cfg.c.
+ * @version     1.0.0
+ * @date        2022-08-10
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#define size_t  ADC_HOST_SIZE_T     /*!< STD_TYPES.h defines size_t for the AVR */
+#include "STD_TYPES.h"
+#undef size_t
+#include "ADC.h"
+#include "ADC_cfg.h"
+#include "ADC_host.h"
+
+#define NUM_OF_PINS     (8U)
+
+typedef struct {
+    u32_t   results;
+    f64_t   sumOfSquares;       /*!< Of the errors in LSB */
+    f64_t   maxError;
+} BENCH_ERROR_t;
+
+static ADC_HOST_WAVE_t pins[NUM_OF_PINS];
+static ADC_HOST_WAVE_t references[NUM_OF_PINS];
+static BENCH_ERROR_t errors[NUM_OF_USED_ADC_CHANNELS];
+
+static ERROR_t BENCH_ParseWave(const char * const arg, ADC_HOST_WAVE_t * const waves);
+static void BENCH_CheckSweep(void);
+static void BENCH_Print(void);
+
+int main(int argc, char * argv[]) {
+    ERROR_t error = ERROR_OK;
+    f64_t seconds = 1.0;
+    u16_t sequence = 0;
+    u16_t lastSequence = 0;
+    int i = 0;
+
+    for(i = 1; (ERROR_OK == error) && (i < argc); ++i) {
+        if( (0 == strcmp(argv[i], "-s")) && (i + 1 < argc) ) {
+            seconds = atof(argv[++i]);
+        } else if(0 == strncmp(argv[i], "ADC", 3)) {
+            error |= BENCH_ParseWave(&argv[i][3], pins);
+        } else if(0 == strncmp(argv[i], "REF", 3)) {
+            error |= BENCH_ParseWave(&argv[i][3], references);
+        } else {
+            error |= ERROR_INVALID_PARAMETER;
+        }
+    }
+
+    if(ERROR_OK != error) {
+        fprintf(stderr, "usage: %s [-s seconds] ADCn=file[,rateHz] [REFn=file[,rateHz]] ...\n", argv[0]);
+        return 1;
+    }
+
+    for(i = 0; i < (int)NUM_OF_PINS; ++i) {
+        (void)ADC_HostConnect((ADC_t)i, (NULL != pins[i].millivolts) ? &pins[i] : NULL);
+    }
+
+    error |= ADC_Init();
+    error |= ADC_StartScan(NULL);
+    if(ERROR_OK != error) {
+        fprintf(stderr, "ADC error 0x%02X\n", error);
+        return 1;
+    }
+
+    while(ADC_HostGetTime() < seconds) {
+        if(0 == ADC_HostRun(1)) {
+            fprintf(stderr, "the scan stopped\n");
+            return 1;
+        }
+
+        (void)ADC_GetScanSequence(&sequence);
+        if(sequence != lastSequence) {
+            lastSequence = sequence;
+            BENCH_CheckSweep();
+        }
+    }
+
+    BENCH_Print();
+
+    for(i = 0; i < (int)NUM_OF_PINS; ++i) {
+        ADC_HostWaveFree(&pins[i]);
+        ADC_HostWaveFree(&references[i]);
+    }
+
+    return 0;
+}
+
+/**************************************************************************
+ * @brief  Load "n=file[,rateHz]" in waves[n].
+ *************************************************************************/
+static ERROR_t BENCH_ParseWave(const char * const arg, ADC_HOST_WAVE_t * const waves) {
+    char path[256];
+    char * comma = NULL;
+    u32_t rateHz = 1000;
+    int pin = -1;
+
+    if( (2 != sscanf(arg, "%d=%255s", &pin, path)) || (pin < 0) || (pin >= (int)NUM_OF_PINS) ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    comma = strrchr(path, ',');
+    if(NULL != comma) {
+        *comma = '\0';
+        rateHz = (u32_t)strtoul(comma + 1, NULL, 10);
+    }
+
+    if(ERROR_OK != ADC_HostWaveLoad(&waves[pin], path, rateHz)) {
+        fprintf(stderr, "can not load %s\n", path);
+        return ERROR_NOK;
+    }
+
+    return ERROR_OK;
+}
+
+/**************************************************************************
+ * @brief  Compare the filtered results of the single ended channels with
+ *         their reference waveform at the current time.
+ *************************************************************************/
+static void BENCH_CheckSweep(void) {
+    const f64_t time = ADC_HostGetTime();
+    const ADC_HOST_WAVE_t * reference = NULL;
+    f64_t referenceMillivolts = 0;
+    f64_t expected = 0;
+    f64_t lsbError = 0;
+    u16_t value = 0;
+    u8_t i = 0;
+
+    for(i = 0; i < countChannelsConfigured; ++i) {
+        const ADC_t pin = adcConfigs[i].adc;
+
+        if( (pin >= NUM_OF_PINS) || (ERROR_OK != ADC_GetScanResult(adcConfigs[i].channel, &value)) ) {
+            continue;
+        }
+
+        reference = (NULL != references[pin].millivolts) ? &references[pin] : &pins[pin];
+        referenceMillivolts = (ADC_REFERENCE_INTERNAL == adcConfigs[i].reference) ? 2560.0 :
+                              (ADC_REFERENCE_AVCC == adcConfigs[i].reference) ?
+                              (f64_t)ADC_AVCC_MILLIVOLTS : (f64_t)ADC_AREF_MILLIVOLTS;
+
+        expected = (ADC_HostWaveAt(reference, time) * (f64_t)(1024UL << adcConfigs[i].resolution)) /
+                   referenceMillivolts;
+        lsbError = fabs((f64_t)value - expected);
+
+        errors[i].results++;
+        errors[i].sumOfSquares += lsbError * lsbError;
+        if(lsbError > errors[i].maxError) {
+            errors[i].maxError = lsbError;
+        }
+    }
+}
+
+static void BENCH_Print(void) {
+    static const char * const stageNames[ADC_HOST_NUM_OF_STAGES] = {"median", "boxcar", "EMA"};
+    ADC_HOST_ISR_STATS_t isrStats;
+    ADC_STATS_t stats;
+    u8_t i = 0;
+
+    printf("simulated time: %.3f s\n\n", ADC_HostGetTime());
+    printf("channel  bits  results  rms error  max error    min    max   mean    rms\n");
+
+    for(i = 0; i < countChannelsConfigured; ++i) {
+        if(0 == errors[i].results) {
+            continue;
+        }
+
+        printf("%7u  %4u  %7lu  %9.2f  %9.2f", adcConfigs[i].channel, 10 + adcConfigs[i].resolution,
+               (unsigned long)errors[i].results, sqrt(errors[i].sumOfSquares / errors[i].results),
+               errors[i].maxError);
+
+        if(ERROR_OK == ADC_GetStats(adcConfigs[i].channel, &stats, 0)) {
+            printf("  %5u  %5u  %5u  %5u", stats.min, stats.max, stats.mean, stats.rms);
+        }
+        printf("\n");
+    }
+
+    ADC_HostGetIsrStats(&isrStats);
+    printf("\nISR: %lu calls, mean %.0f ns, max %.0f ns (host time)\n", (unsigned long)isrStats.calls,
+           (0 != isrStats.calls) ? (isrStats.totalNs / isrStats.calls) : 0.0, isrStats.maxNs);
+
+    for(i = 0; i < ADC_HOST_NUM_OF_STAGES; ++i) {
+        ADC_HostGetStageStats(i, &isrStats);
+        if(0 != isrStats.calls) {
+            printf("  %-6s %7lu calls, mean %.1f ns, max %.0f ns\n", stageNames[i], (unsigned long)isrStats.calls,
+                   isrStats.totalNs / isrStats.calls, isrStats.maxNs);
+        }
+    }
+}
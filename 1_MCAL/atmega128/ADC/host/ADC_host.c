@@ -0,0 +1,486 @@
+/******************************************************************************
+ * @file        ADC_host.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Simulated ADC of the ATmega128, to build \ref ADC.c on a Linux
+ *              host (with -DADC_HOST, see ADC_reg.h).
+ * @details     The registers of ADC_reg.h are variables of this file. When a
+ *              conversion is started (ADSC), \ref ADC_HostRun or a busy wait of
+ *              ADC.c converts the value of the selected input at the simulated
+ *              time, writes ADCL/ADCH as the hardware (ADLAR, two's complement
+ *              for the differential inputs), sets ADIF and calls __vector_21()
+ *              if ADIE and the I bit are set. The free running mode (ADFR)
+ *              restarts the conversion.
+ *
+ *              The simulated time advances by 13 ADC clocks per conversion, so
+ *              the inputs are sampled as on the target. The first conversion
+ *              after enabling the ADC (25 clocks) is not modelled.
+ *
+ *              The drivers used by ADC.c are replaced too: GIE works on the
+ *              simulated SREG, EEPROM is a RAM array, and TIMER_Reserve()
+ *              returns ERROR_NOK: the timer paced capture is not simulated.
+ * @version     1.0.0
+ * @date        2022-08-10
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#define size_t  ADC_HOST_SIZE_T     /*!< STD_TYPES.h defines size_t for the AVR */
+#include "STD_TYPES.h"
+#undef size_t
+#include "BIT_MATH.h"
+#include "GIE.h"
+#include "TIMER.h"
+#include "EEPROM.h"
+#include "ADC.h"
+#include "ADC_cfg.h"
+#include "ADC_reg.h"
+#include "ADC_host.h"
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE VARIABLES                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+volatile ADC_REG_t ADC_HostRegisters;
+volatile u8_t ADC_HostSreg = 0;
+volatile u8_t ADC_HostMcucr = 0;
+volatile u8_t ADC_HostEimsk = 0;
+volatile u8_t ADC_HostTimsk = 0;
+
+static const ADC_HOST_WAVE_t * ADC_HostPins[ADC_DIFF_0_0_X10];     /*!< Waveform of ADC_0 to ADC_7 */
+static u64_t ADC_HostCycles = 0;                                    /*!< Simulated CPU cycles */
+static u8_t ADC_HostIsInIsr = 0;
+static ADC_HOST_ISR_STATS_t ADC_HostIsrStats;
+static ADC_HOST_ISR_STATS_t ADC_HostStageStats[ADC_HOST_NUM_OF_STAGES];
+static struct timespec ADC_HostStageStart;
+static f64_t ADC_HostClockNs = -1;              /*!< Cost of two clock_gettime(), -1 before measured */
+static f64_t ADC_HostIsrClockNs = 0;            /*!< Cost of the stage timings in the ISR in progress */
+
+static u8_t ADC_HostEeprom[4096];
+static u8_t ADC_HostIsEepromErased = 0;
+
+/*!< Pins and gain of each differential input, in the order of ADC_t */
+typedef struct {
+    u8_t    positive;
+    u8_t    negative;
+    u8_t    gain;
+} ADC_HOST_DIFF_t;
+
+static const ADC_HOST_DIFF_t ADC_HostDiffs[NUM_OF_ADC_CHANNELS - ADC_DIFF_0_0_X10] = {
+    {0, 0, 10},  {1, 0, 10},  {0, 0, 200}, {1, 0, 200},
+    {2, 2, 10},  {3, 2, 10},  {2, 2, 200}, {3, 2, 200},
+    {0, 1, 1},   {1, 1, 1},   {2, 1, 1},   {3, 1, 1},
+    {4, 1, 1},   {5, 1, 1},   {6, 1, 1},   {7, 1, 1},
+    {0, 2, 1},   {1, 2, 1},   {2, 2, 1},   {3, 2, 1},
+    {4, 2, 1},   {5, 2, 1},
+};
+
+/*!< The ISR of ADC.c */
+void __vector_21(void);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                          PRIVATE FUNCTIONS PROTOTYPES                       */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+static u8_t ADC_HostConvert(void);
+static u16_t ADC_HostGetCode(const u8_t mux, const u8_t refs);
+static f64_t ADC_HostPinMillivolts(const u8_t pin);
+static void ADC_HostCallIsr(void);
+static f64_t ADC_HostElapsedNs(const struct timespec * const start, const struct timespec * const end);
+static void ADC_HostMeasureClock(void);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUBLIC FUNCTIONS                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+ERROR_t ADC_HostWaveLoad(ADC_HOST_WAVE_t * const wave, const char * const path, const u32_t sampleRateHz) {
+    FILE * file = NULL;
+    const char * extension = NULL;
+    u32_t capacity = 1024;
+    char line[64];
+    s16_t sample = 0;
+
+    if( (NULL == wave) || (NULL == path) ) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if(0 == sampleRateHz) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    extension = strrchr(path, '.');
+    file = fopen(path, "rb");
+    if(NULL == file) {
+        return ERROR_NOK;
+    }
+
+    wave->millivolts = malloc(capacity * sizeof(f64_t));
+    wave->length = 0;
+    wave->sampleRateHz = sampleRateHz;
+
+    while(NULL != wave->millivolts) {
+        if( (NULL != extension) && (0 == strcmp(extension, ".bin")) ) {
+            u8_t bytes[2];
+
+            if(2 != fread(bytes, 1, 2, file)) {
+                break;
+            }
+            sample = (s16_t)(bytes[0] | (bytes[1] << 8));
+            wave->millivolts[wave->length] = sample;
+        } else {
+            if(NULL == fgets(line, sizeof(line), file)) {
+                break;
+            }
+            if(1 != sscanf(line, "%lf", &wave->millivolts[wave->length])) {
+                continue;       /*!< Header or empty line */
+            }
+        }
+
+        if(++wave->length == capacity) {
+            capacity *= 2;
+            wave->millivolts = realloc(wave->millivolts, capacity * sizeof(f64_t));
+        }
+    }
+
+    fclose(file);
+
+    if( (NULL == wave->millivolts) || (0 == wave->length) ) {
+        ADC_HostWaveFree(wave);
+        return ERROR_NOK;
+    }
+
+    return ERROR_OK;
+}
+
+void ADC_HostWaveFree(ADC_HOST_WAVE_t * const wave) {
+    if(NULL != wave) {
+        free(wave->millivolts);
+        wave->millivolts = NULL;
+        wave->length = 0;
+    }
+}
+
+f64_t ADC_HostWaveAt(const ADC_HOST_WAVE_t * const wave, const f64_t timeS) {
+    if( (NULL == wave) || (0 == wave->length) ) {
+        return 0.0;
+    }
+
+    return wave->millivolts[(u64_t)(timeS * wave->sampleRateHz) % wave->length];
+}
+
+ERROR_t ADC_HostConnect(const ADC_t pin, const ADC_HOST_WAVE_t * const wave) {
+    if(pin >= ADC_DIFF_0_0_X10) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    ADC_HostPins[pin] = wave;
+
+    return ERROR_OK;
+}
+
+u32_t ADC_HostRun(const u32_t conversions) {
+    u32_t count = 0;
+
+    while( (count < conversions) && ADC_HostConvert() ) {
+        ++count;
+    }
+
+    return count;
+}
+
+void ADC_HostIdle(void) {
+    /*!< Entering the ADC noise reduction sleep starts a conversion */
+    if( (0 != BIT_IS_SET(ADC_HostMcucr, SLEEP_SE)) &&
+        ((ADC_HostMcucr & ((1 << SLEEP_SM2) | (1 << SLEEP_SM1) | (1 << SLEEP_SM0))) == (1 << SLEEP_SM0)) ) {
+        BIT_SET(ADC_HostRegisters.ADCSRA, ADSC);
+    }
+
+    (void)ADC_HostConvert();
+}
+
+f64_t ADC_HostGetTime(void) {
+    return (f64_t)ADC_HostCycles / F_CPU;
+}
+
+void ADC_HostGetIsrStats(ADC_HOST_ISR_STATS_t * const ptrToStats) {
+    if(NULL != ptrToStats) {
+        *ptrToStats = ADC_HostIsrStats;
+    }
+}
+
+void ADC_HostGetStageStats(const u8_t stage, ADC_HOST_ISR_STATS_t * const ptrToStats) {
+    if( (NULL != ptrToStats) && (stage < ADC_HOST_NUM_OF_STAGES) ) {
+        *ptrToStats = ADC_HostStageStats[stage];
+    }
+}
+
+void ADC_HostStageBegin(void) {
+    clock_gettime(CLOCK_MONOTONIC, &ADC_HostStageStart);
+}
+
+void ADC_HostStageEnd(const u8_t stage) {
+    struct timespec end;
+    f64_t ns = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    ns = ADC_HostElapsedNs(&ADC_HostStageStart, &end) - ADC_HostClockNs;
+    if(ns < 0) {
+        ns = 0;
+    }
+    ADC_HostIsrClockNs += ADC_HostClockNs;
+
+    if(stage < ADC_HOST_NUM_OF_STAGES) {
+        ++ADC_HostStageStats[stage].calls;
+        ADC_HostStageStats[stage].totalNs += ns;
+        if(ns > ADC_HostStageStats[stage].maxNs) {
+            ADC_HostStageStats[stage].maxNs = ns;
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE FUNCTIONS                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**************************************************************************
+ * @brief  Run the conversion in progress, if any.
+ * @return 1 if a conversion was done.
+ *************************************************************************/
+static u8_t ADC_HostConvert(void) {
+    const u8_t adcsra = ADC_HostRegisters.ADCSRA;
+    const u8_t admux = ADC_HostRegisters.ADMUX;
+    const u8_t prescaler = (adcsra >> ADPS0) & 0x07;
+    u16_t code = 0;
+
+    if( (0 == BIT_IS_SET(adcsra, ADEN)) || (0 == BIT_IS_SET(adcsra, ADSC)) ) {
+        return 0;
+    }
+
+    /*!< ADIF is written with 1 to clear it: a 1 left by the driver is not a
+         new result. The hardware clears it when the conversion restarts too */
+    BIT_CLR(ADC_HostRegisters.ADCSRA, ADIF);
+
+    /*!< ADPS 0 and 1 divide by 2 */
+    ADC_HostCycles += 13UL << ((0 == prescaler) ? 1 : prescaler);
+
+    code = ADC_HostGetCode(admux & 0x1F, admux >> REFS0);
+
+    if(0 != BIT_IS_SET(admux, ADLAR)) {
+        ADC_HostRegisters.ADCL = (u8_t)(code << 6);
+        ADC_HostRegisters.ADCH = (u8_t)(code >> 2);
+    } else {
+        ADC_HostRegisters.ADCL = (u8_t)code;
+        ADC_HostRegisters.ADCH = (u8_t)(code >> 8);
+    }
+
+    if(0 == BIT_IS_SET(adcsra, ADFR)) {
+        BIT_CLR(ADC_HostRegisters.ADCSRA, ADSC);
+    }
+    BIT_SET(ADC_HostRegisters.ADCSRA, ADIF);
+
+    if( (0 != BIT_IS_SET(ADC_HostRegisters.ADCSRA, ADIE)) && (0 != BIT_IS_SET(ADC_HostSreg, I_BIT)) &&
+        !ADC_HostIsInIsr ) {
+        ADC_HostCallIsr();
+    }
+
+    return 1;
+}
+
+/**************************************************************************
+ * @brief  Call the ISR as the hardware: ADIF and the I bit are cleared on
+ *         entry, the I bit is set by reti.
+ *************************************************************************/
+static void ADC_HostCallIsr(void) {
+    struct timespec start;
+    struct timespec end;
+    f64_t ns = 0;
+
+    if(ADC_HostClockNs < 0) {
+        ADC_HostMeasureClock();
+    }
+
+    BIT_CLR(ADC_HostRegisters.ADCSRA, ADIF);
+    BIT_CLR(ADC_HostSreg, I_BIT);
+    ADC_HostIsInIsr = 1;
+    ADC_HostIsrClockNs = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    __vector_21();
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    ADC_HostIsInIsr = 0;
+    BIT_SET(ADC_HostSreg, I_BIT);
+
+    /*!< Without the timing of the filter stages */
+    ns = ADC_HostElapsedNs(&start, &end) - ADC_HostIsrClockNs;
+    ++ADC_HostIsrStats.calls;
+    ADC_HostIsrStats.totalNs += ns;
+    if(ns > ADC_HostIsrStats.maxNs) {
+        ADC_HostIsrStats.maxNs = ns;
+    }
+}
+
+static f64_t ADC_HostElapsedNs(const struct timespec * const start, const struct timespec * const end) {
+    return ((f64_t)(end->tv_sec - start->tv_sec) * 1e9) + (f64_t)(end->tv_nsec - start->tv_nsec);
+}
+
+/**************************************************************************
+ * @brief  Cost of a stage timing: the smallest of 1000 back to back
+ *         clock_gettime() pairs. Removed from each stage.
+ *************************************************************************/
+static void ADC_HostMeasureClock(void) {
+    struct timespec start;
+    struct timespec end;
+    f64_t ns = 0;
+    u16_t i = 0;
+
+    for(i = 0; i < 1000; ++i) {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        ns = ADC_HostElapsedNs(&start, &end);
+        if( (ADC_HostClockNs < 0) || (ns < ADC_HostClockNs) ) {
+            ADC_HostClockNs = ns;
+        }
+    }
+}
+
+/**************************************************************************
+ * @brief  10 bits result of an input at the simulated time.
+ * @param[in]  mux: MUX4:0 (see ADC_t).
+ * @param[in]  refs: REFS1:0.
+ *************************************************************************/
+static u16_t ADC_HostGetCode(const u8_t mux, const u8_t refs) {
+    const f64_t reference = (0x03 == refs) ? 2560.0 :
+                            (0x01 == refs) ? (f64_t)ADC_AVCC_MILLIVOLTS : (f64_t)ADC_AREF_MILLIVOLTS;
+    const ADC_HOST_DIFF_t * diff = NULL;
+    f64_t code = 0;
+
+    if(mux < ADC_DIFF_0_0_X10) {
+        code = (ADC_HostPinMillivolts(mux) * 1024.0) / reference;
+        code = (code < 0) ? 0 : ((code > 1023) ? 1023 : code);
+        return (u16_t)code;
+    }
+
+    if(mux >= NUM_OF_ADC_CHANNELS) {
+        return (0x1E == mux) ? (u16_t)((1230.0 * 1024.0) / reference) : 0;     /*!< 1.23 V or GND */
+    }
+
+    /*!< Two's complement, -512 to 511 */
+    diff = &ADC_HostDiffs[mux - ADC_DIFF_0_0_X10];
+    code = ((ADC_HostPinMillivolts(diff->positive) - ADC_HostPinMillivolts(diff->negative)) *
+            diff->gain * 512.0) / reference;
+    code = (code < -512) ? -512 : ((code > 511) ? 511 : code);
+
+    return (u16_t)((s16_t)code) & 0x3FF;
+}
+
+static f64_t ADC_HostPinMillivolts(const u8_t pin) {
+    return ADC_HostWaveAt(ADC_HostPins[pin], ADC_HostGetTime());
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                      DRIVERS USED BY ADC.c ON THE HOST                      */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+void GIE_Enable(void) {
+    BIT_SET(ADC_HostSreg, I_BIT);
+}
+
+void GIE_Disable(void) {
+    BIT_CLR(ADC_HostSreg, I_BIT);
+}
+
+ERROR_t EEPROM_Read(const u16_t address, u8_t * const ptrToData, const u16_t length) {
+    if(NULL == ptrToData) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if( ((u32_t)address + length) > sizeof(ADC_HostEeprom) ) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    if(!ADC_HostIsEepromErased) {
+        memset(ADC_HostEeprom, 0xFF, sizeof(ADC_HostEeprom));
+        ADC_HostIsEepromErased = 1;
+    }
+
+    memcpy(ptrToData, &ADC_HostEeprom[address], length);
+
+    return ERROR_OK;
+}
+
+ERROR_t EEPROM_Write(const u16_t address, const u8_t * const ptrToData, const u16_t length) {
+    u8_t unused = 0;
+
+    (void)EEPROM_Read(0, &unused, 1);       /*!< Erase it on the first use */
+
+    if(NULL == ptrToData) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if( ((u32_t)address + length) > sizeof(ADC_HostEeprom) ) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    memcpy(&ADC_HostEeprom[address], ptrToData, length);
+
+    return ERROR_OK;
+}
+
+ERROR_t TIMER_Reserve(const TIMER_t timer, const u8_t resources, const TIMER_USER_t user,
+                      const TIMER_CLOCK_t clock, const TIMER_MODE_t timerMode) {
+    (void)timer;
+    (void)resources;
+    (void)user;
+    (void)clock;
+    (void)timerMode;
+
+    return ERROR_NOK;       /*!< No timer on the host */
+}
+
+ERROR_t TIMER_Release(const TIMER_t timer, const u8_t resources, const TIMER_USER_t user) {
+    (void)timer;
+    (void)resources;
+    (void)user;
+
+    return ERROR_OK;
+}
+
+void TIMER1_Init(const u16_t initValue, const TIMER_CLOCK_t clock,
+                 const TIMER_MODE_t timerMode, const TIMER_OC_t compareMode,
+                 const TIMER_OCx_t OCx) {
+    (void)initValue;
+    (void)clock;
+    (void)timerMode;
+    (void)compareMode;
+    (void)OCx;
+}
+
+u16_t TIMER1_GetTimerValue(void) {
+    return (u16_t)ADC_HostCycles;
+}
+
+void TIMER1_SetCompareValue(const u16_t compareValue, const TIMER_OCx_t OCx) {
+    (void)compareValue;
+    (void)OCx;
+}
+
+void TIMER1_EnableCompareMatchInterrupt(const TIMER_OCx_t OCx, void (* const callbackFunction)(void)) {
+    (void)OCx;
+    (void)callbackFunction;
+}
+
+void TIMER1_DisableCompareMatchInterrupt(const TIMER_OCx_t OCx) {
+    (void)OCx;
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * @file            ADC_host.h
+ * @author          Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief           Interface of the simulated ADC used to build \ref ADC.c on
+ *                  a Linux host (\ref ADC_host.c)
+ * @version         1.0.0
+ * @date            2022-08-10
+ * PRECONDITIONS:   - ADC.c and ADC_cfg.c are built with -DADC_HOST
+ *                  - ADC.h and ADC_cfg.h must be included before ADC_host.h
+ * @copyright       Copyright (c) 2022
+ ******************************************************************************/
+#ifndef ADC_HOST_H
+#define ADC_HOST_H
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   A waveform in mV, sampled at a fixed rate. It repeats from the
+ *          start after its last sample.
+ ******************************************************************************/
+typedef struct {
+    f64_t * millivolts;
+    u32_t   length;
+    u32_t   sampleRateHz;
+} ADC_HOST_WAVE_t;
+
+/*!< Filter stages timed in the ISR: ADC_STAGE_MEDIAN, ADC_STAGE_BOXCAR and
+     ADC_STAGE_EMA of ADC_reg.h */
+#define ADC_HOST_NUM_OF_STAGES      (3U)
+
+/******************************************************************************
+ * @brief   Time spent in the ADC ISR on the host, see \ref ADC_HostGetIsrStats,
+ *          or in a stage of the scan filters, see \ref ADC_HostGetStageStats.
+ * @note    These are host nanoseconds: use them to compare two versions of
+ *          the ISR code, not as AVR cycles.
+ ******************************************************************************/
+typedef struct {
+    u32_t   calls;
+    f64_t   totalNs;
+    f64_t   maxNs;
+} ADC_HOST_ISR_STATS_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                             API FUNCTIONS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief       Load a waveform from a file.
+ * @param[out]  wave: Loaded waveform, free it with ADC_HostWaveFree().
+ * @param[in]   path: Text file: one value in mV per line (a CSV with one
+ *              column), or binary file (*.bin): s16_t little endian mV.
+ * @param[in]   sampleRateHz: Rate of the samples of the file.
+ * @return      ERROR_t: ERROR_NOK if the file can not be read or is empty.
+ ******************************************************************************/
+ERROR_t ADC_HostWaveLoad(ADC_HOST_WAVE_t * const wave, const char * const path, const u32_t sampleRateHz);
+
+void ADC_HostWaveFree(ADC_HOST_WAVE_t * const wave);
+
+/*******************************************************************************
+ * @brief       Value of a waveform at a time (the sample before it).
+ ******************************************************************************/
+f64_t ADC_HostWaveAt(const ADC_HOST_WAVE_t * const wave, const f64_t timeS);
+
+/*******************************************************************************
+ * @brief       Feed an input pin (ADC_0 to ADC_7) of the simulated ADC with a
+ *              waveform. NULL for 0 V. The wave must stay valid while used.
+ * @note        The differential inputs of ADC_t are computed from the pins.
+ ******************************************************************************/
+ERROR_t ADC_HostConnect(const ADC_t pin, const ADC_HOST_WAVE_t * const wave);
+
+/*******************************************************************************
+ * @brief       Run the converter for a number of conversions, or until it is
+ *              stopped. Each conversion advances the simulated time by 13 ADC
+ *              clocks, writes the result and runs the ISR when it is enabled.
+ * @return      u32_t: Conversions done.
+ ******************************************************************************/
+u32_t ADC_HostRun(const u32_t conversions);
+
+/*******************************************************************************
+ * @brief       Run the conversion in progress to its end. Called by the busy
+ *              waits and the sleep of ADC.c (ADC_WAIT() in ADC_reg.h).
+ ******************************************************************************/
+void ADC_HostIdle(void);
+
+/*******************************************************************************
+ * @brief       Simulated time since the start in seconds.
+ ******************************************************************************/
+f64_t ADC_HostGetTime(void);
+
+void ADC_HostGetIsrStats(ADC_HOST_ISR_STATS_t * const ptrToStats);
+
+/*******************************************************************************
+ * @brief       Time spent in a stage of the scan filters (ADC_Filter() of
+ *              ADC.c), without the cost of clock_gettime(). The ISR time of
+ *              \ref ADC_HostGetIsrStats does not include the timing either.
+ * @param[in]   stage: ADC_STAGE_MEDIAN (0), ADC_STAGE_BOXCAR (1) or
+ *              ADC_STAGE_EMA (2).
+ ******************************************************************************/
+void ADC_HostGetStageStats(const u8_t stage, ADC_HOST_ISR_STATS_t * const ptrToStats);
+
+#endif      /* ADC_HOST_H */
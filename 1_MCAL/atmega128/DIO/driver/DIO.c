@@ -277,6 +277,27 @@ ERROR_t DIO_SetNibbleValue(const DIO_PINS_t startPinName, const u8_t value) {
 }
 
 
+ERROR_t DIO_GetPinRegister(const DIO_PINS_t name, volatile u8_t ** const ptrToPort, 
+                           u8_t * const ptrToMask) {
+    ERROR_t error = ERROR_OK;
+    s8_t i = -1;
+
+    if( (NULL == ptrToPort) || (NULL == ptrToMask) ) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= DIO_IsPinAvailable(name, &i);
+
+    if( (ERROR_OK == error) && (i >= 0) ) {
+        *ptrToPort = PORT_reg[pinConfigs[i].port];
+        *ptrToMask = (u8_t)(1 << pinConfigs[i].pin);
+    } else {
+        error |= ERROR_INVALID_PARAMETER;
+    }
+
+    return error;
+}
+
 
 /*----------------------------------------------------------------------------*/
 /*                                                                            */
@@ -39,8 +39,21 @@ typedef enum {
 
     /* Testing LED  */
     DIO_PINS_TEST_LED,
+
+    /* SPI pins (see SPI_cfg.c) */
+    DIO_PINS_SPI_SS,
+    DIO_PINS_SPI_SCK,
+    DIO_PINS_SPI_MOSI,
+    DIO_PINS_SPI_MISO,
+
+    /* Chip selects of the SPI devices (see SPI_BUS_cfg.c) */
+    DIO_PINS_FLASH_CS,
+    DIO_PINS_DISPLAY_CS,
 } DIO_PINS_t;
 
+/*!< PB0 is the SS of the master and the CSN of the nrf24: one pin, one entry */
+#define DIO_PINS_NRF24_CSN      DIO_PINS_SPI_SS
+
 /******************************************************************************
  * @brief   Enum for the directions of the pins.
  * @details This enum is used to be readable for the user instead of using 
@@ -373,4 +386,23 @@ ERROR_t DIO_SetClrPortDirection(const DIO_PINS_t pinInThePort, const DIO_DIR_t d
  ******************************************************************************/ 
 ERROR_t DIO_SetNibbleValue(const DIO_PINS_t startPin, const u8_t value);
 
+/*******************************************************************************
+ * @brief       Get the PORT register and the bit mask of a pin, so that time
+ *              critical code (ISRs) can write the pin without searching the
+ *              configurations on every write.
+ * @param[in]   pin: The pin. See \ref DIO_PINS_t for options.
+ * @param[out]  ptrToPort: Pointer to the PORT register of the pin.
+ * @param[out]  ptrToMask: Bit mask of the pin in the PORT register.
+ * @return      ERROR_t: Error code. See \ref ERROR_t for more information.
+ * @par         Example:
+ *              @code
+ *              volatile u8_t * port;
+ *              u8_t mask;
+ *              DIO_GetPinRegister(DIO_PINS_LED_0, &port, &mask);
+ *              *port |= mask;      // Set LED_0 HIGH
+ *              @endcode
+ ******************************************************************************/
+ERROR_t DIO_GetPinRegister(const DIO_PINS_t pin, volatile u8_t ** const ptrToPort, 
+                           u8_t * const ptrToMask);
+
 #endif      /* DIO_H */
\ No newline at end of file
@@ -48,6 +48,17 @@ DIO_PIN_CONFIGS_t  pinConfigs[] = {
 
     /* Testing LED  */
     {DIO_PINS_TEST_LED, DIO_PIN_7, DIO_PORT_C, DIO_OUTPUT, DIO_PULLUP_OFF},
+
+    /* SPI: fixed by the hardware, the directions are set by SPI_Init().
+       SS is an output: a floating SS of a master may switch it to slave */
+    {DIO_PINS_SPI_SS,   DIO_PIN_0, DIO_PORT_B, DIO_OUTPUT, DIO_PULLUP_OFF},       /* Also DIO_PINS_NRF24_CSN */
+    {DIO_PINS_SPI_SCK,  DIO_PIN_1, DIO_PORT_B, DIO_INPUT, DIO_PULLUP_OFF},
+    {DIO_PINS_SPI_MOSI, DIO_PIN_2, DIO_PORT_B, DIO_INPUT, DIO_PULLUP_OFF},
+    {DIO_PINS_SPI_MISO, DIO_PIN_3, DIO_PORT_B, DIO_INPUT, DIO_PULLUP_OFF},
+
+    /* SPI chip selects: set HIGH (inactive) by SPI_BUS_Init() */
+    {DIO_PINS_FLASH_CS,   DIO_PIN_0, DIO_PORT_G, DIO_OUTPUT, DIO_PULLUP_OFF},
+    {DIO_PINS_DISPLAY_CS, DIO_PIN_1, DIO_PORT_G, DIO_OUTPUT, DIO_PULLUP_OFF},
 };
 
 
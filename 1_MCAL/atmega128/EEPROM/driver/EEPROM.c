@@ -0,0 +1,103 @@
+/******************************************************************************
+ * @file        EEPROM.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Internal EEPROM driver for Atmega128 microcontroller.
+ * @version     1.0.0
+ * @date        2022-07-22
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "GIE.h"
+#include "EEPROM_reg.h"
+#include "EEPROM.h"
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                          PRIVATE FUNCTIONS PROTOTYPES                       */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+static u8_t EEPROM_ReadByte(const u16_t address);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              MACRO LIKE FUNCTIONS                           */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+#define ASSERT_VALID_RANGE(address, length)     ( ((u32_t)(address) + (length)) <= EEPROM_SIZE )
+
+#define EEPROM_WAIT_WRITE()     while(BIT_IS_SET(EECR, EEWE)) { /*!< Wait for the last write */ }
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUBLIC FUNCTIONS                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+ERROR_t EEPROM_Read(const u16_t address, u8_t * const ptrToData, const u16_t length) {
+    u16_t i = 0;
+
+    if(NULL == ptrToData) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if(!ASSERT_VALID_RANGE(address, length)) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    for(i = 0; i < length; ++i) {
+        ptrToData[i] = EEPROM_ReadByte(address + i);
+    }
+
+    return ERROR_OK;
+}
+
+ERROR_t EEPROM_Write(const u16_t address, const u8_t * const ptrToData, const u16_t length) {
+    u8_t u8_tSreg = 0;
+    u16_t i = 0;
+
+    if(NULL == ptrToData) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if(!ASSERT_VALID_RANGE(address, length)) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    for(i = 0; i < length; ++i) {
+        if(EEPROM_ReadByte(address + i) == ptrToData[i]) {
+            continue;
+        }
+
+        EEARH = (u8_t)((address + i) >> 8);
+        EEARL = (u8_t)(address + i);
+        EEDR  = ptrToData[i];
+
+        /*!< EEWE must be set within 4 cycles after EEMWE: no interrupt in between */
+        u8_tSreg = SREG;
+        GIE_Disable();
+        BIT_SET(EECR, EEMWE);
+        BIT_SET(EECR, EEWE);
+        SREG = u8_tSreg;
+    }
+
+    EEPROM_WAIT_WRITE();
+
+    return ERROR_OK;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE FUNCTIONS                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+static u8_t EEPROM_ReadByte(const u16_t address) {
+    EEPROM_WAIT_WRITE();
+
+    EEARH = (u8_t)(address >> 8);
+    EEARL = (u8_t)address;
+    BIT_SET(EECR, EERE);
+
+    return EEDR;
+}
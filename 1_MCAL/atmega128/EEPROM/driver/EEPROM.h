@@ -0,0 +1,40 @@
+/******************************************************************************
+ * @file            EEPROM.h
+ * @author          Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief           Interfaces header file for \ref EEPROM.c
+ * @version         1.0.0
+ * @date            2022-07-22
+ * PRECONDITIONS:   - EEPROM.c must be included in the project
+ * @copyright       Copyright (c) 2022
+ ******************************************************************************/
+#ifndef EEPROM_H
+#define EEPROM_H
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                             API FUNCTIONS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief       Read bytes from the internal EEPROM.
+ * @param[in]   address: Address of the first byte.
+ * @param[out]  ptrToData: Buffer of at least length bytes.
+ * @param[in]   length: Number of bytes.
+ * @return      ERROR_t: ERROR_OUT_OF_RANGE if the bytes are not in the EEPROM.
+ * @note        Waits for a write in progress. A read stops the CPU for 4 cycles.
+ ******************************************************************************/
+ERROR_t EEPROM_Read(const u16_t address, u8_t * const ptrToData, const u16_t length);
+
+/*******************************************************************************
+ * @brief       Write bytes to the internal EEPROM. Bytes that already have the
+ *              value are not written, to save time and wear.
+ * @param[in]   address: Address of the first byte.
+ * @param[in]   ptrToData: Bytes to write.
+ * @param[in]   length: Number of bytes.
+ * @return      ERROR_t: ERROR_OUT_OF_RANGE if the bytes are not in the EEPROM.
+ * @note        Blocking: a byte takes about 8.5 ms to write.
+ ******************************************************************************/
+ERROR_t EEPROM_Write(const u16_t address, const u8_t * const ptrToData, const u16_t length);
+
+#endif      /* EEPROM_H */
@@ -0,0 +1,35 @@
+/*******************************************************************************
+ * @file    EEPROM_reg.h
+ * @author  Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief   EEPROM Registers of ATmega128 microcontroller.
+ * @version 1.0.0
+ * @date    2022-07-22
+ ******************************************************************************/
+#ifndef EEPROM_REG_H
+#define EEPROM_REG_H
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              CHANGE THIS PART ONLY FOR NEW DEVICES                         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#define EECR        (* ((volatile u8_t *) 0x3C) )   /* EEPROM Control Register */
+#define EEDR        (* ((volatile u8_t *) 0x3D) )   /* EEPROM Data Register */
+#define EEARL       (* ((volatile u8_t *) 0x3E) )   /* EEPROM Address Register Low */
+#define EEARH       (* ((volatile u8_t *) 0x3F) )   /* EEPROM Address Register High */
+
+#ifndef SREG
+#define SREG        (* ((volatile u8_t *) 0x5F) )
+#endif
+
+#define EEPROM_SIZE (4096U)                         /* Bytes of EEPROM */
+
+enum {
+    EERE,       /* EEPROM Read Enable */
+    EEWE,       /* EEPROM Write Enable */
+    EEMWE,      /* EEPROM Master Write Enable */
+    EERIE,      /* EEPROM Ready Interrupt Enable */
+};  /* EECR: EEPROM Control Register */
+
+#endif    /* EEPROM_REG_H */
@@ -225,59 +225,80 @@ static void ISR_Generic(const EXTI_t extiNumber) {
     #endif
 }
 
+#if (EXTI_HANDLERS_BINDING == BINDING_STATIC)
+/*!< Handlers are bound at link time: the application overrides the weak ones.
+     Only the flag is cleared (written alone, so other pending flags are kept) */
+#define EXTI_DISPATCH(N)    do { EIFR = (1 << EXTI_##N); EXTI##N##_Handler(); } while(0)
+
+static void EXTI_DefaultHandler(void) {
+    /* DEBUG    */
+}
+
+void EXTI0_Handler(void) __attribute__((weak, alias("EXTI_DefaultHandler")));
+void EXTI1_Handler(void) __attribute__((weak, alias("EXTI_DefaultHandler")));
+void EXTI2_Handler(void) __attribute__((weak, alias("EXTI_DefaultHandler")));
+void EXTI3_Handler(void) __attribute__((weak, alias("EXTI_DefaultHandler")));
+void EXTI4_Handler(void) __attribute__((weak, alias("EXTI_DefaultHandler")));
+void EXTI5_Handler(void) __attribute__((weak, alias("EXTI_DefaultHandler")));
+void EXTI6_Handler(void) __attribute__((weak, alias("EXTI_DefaultHandler")));
+void EXTI7_Handler(void) __attribute__((weak, alias("EXTI_DefaultHandler")));
+#else
+#define EXTI_DISPATCH(N)    ISR_Generic(EXTI_##N)
+#endif
+
 /*!< ISR of INT0                      */
 void __vector_1(void) __attribute__((signal));
 void __vector_1(void) {
 
-    ISR_Generic(EXTI_0);
+    EXTI_DISPATCH(0);
 }
 
 /*!< ISR of INT1        */
 void __vector_2(void) __attribute__((signal));
 void __vector_2(void) {
-    
-    ISR_Generic(EXTI_1);
+
+    EXTI_DISPATCH(1);
 }
 
 /*!< ISR of INT2                      */
 void __vector_3(void) __attribute__((signal));
 void __vector_3(void) {
-    
-    ISR_Generic(EXTI_2);
+
+    EXTI_DISPATCH(2);
 }
 
 /*!< ISR of INT3                      */
 void __vector_4(void) __attribute__((signal));
 void __vector_4(void) {
-    
-    ISR_Generic(EXTI_3);
+
+    EXTI_DISPATCH(3);
 }
 
 /*!< ISR of INT4                      */
 void __vector_5(void) __attribute__((signal));
 void __vector_5(void) {
-    
-    ISR_Generic(EXTI_4);
+
+    EXTI_DISPATCH(4);
 }
 
 /*!< ISR of INT5                      */
 void __vector_6(void) __attribute__((signal));
 void __vector_6(void) {
-    
-    ISR_Generic(EXTI_5);
+
+    EXTI_DISPATCH(5);
 }
 
 /*!< ISR of INT6                      */
 void __vector_7(void) __attribute__((signal));
 void __vector_7(void) {
-    
-    ISR_Generic(EXTI_6);
+
+    EXTI_DISPATCH(6);
 }
 
 /*!< ISR of INT7                      */
 void __vector_8(void) __attribute__((signal));
 void __vector_8(void) {
-    
-    ISR_Generic(EXTI_7);
+
+    EXTI_DISPATCH(7);
 }
 
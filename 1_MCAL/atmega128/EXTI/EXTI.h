@@ -60,4 +60,18 @@ void EXTI_EnableExternalInterrupt(const EXTI_t extiNumber);
  *****************************************************************************/
 void EXTI_DisableExternalInterrupt(const EXTI_t extiNumber);
 
+/******************************************************************************
+ * @brief   Called by the ISRs instead of the callbacks when
+ *          EXTI_HANDLERS_BINDING is BINDING_STATIC (see EXTI_cfg.h). They are
+ *          weak and empty in EXTI.c, so define only the ones you need.
+ *****************************************************************************/
+void EXTI0_Handler(void);
+void EXTI1_Handler(void);
+void EXTI2_Handler(void);
+void EXTI3_Handler(void);
+void EXTI4_Handler(void);
+void EXTI5_Handler(void);
+void EXTI6_Handler(void);
+void EXTI7_Handler(void);
+
 #endif                  
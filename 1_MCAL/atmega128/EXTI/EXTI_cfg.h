@@ -9,6 +9,8 @@
 #ifndef EXTI_CFG_H       
 #define EXTI_CFG_H   
 
+#include "BINDING.h"
+
 /*----------------------------------------------------------------------------*/
 /*                                                                            */
 /*                   CHANGE THIS PART TO YOUR NEEDS                           */
@@ -23,6 +25,15 @@
  *****************************************************************************/
 #define NESTING     NESTING_ENABLED
 
+/******************************************************************************
+ * @brief Binding of the INT0 to INT7 ISRs to the application (see
+ *        BINDING.h).
+ *        Options are:
+ *          BINDING_RUNTIME --> the callbacks passed to EXTI_Init()
+ *          BINDING_STATIC  --> EXTIn_Handler() (see EXTI.h)
+ *****************************************************************************/
+#define EXTI_HANDLERS_BINDING      BINDING_RUNTIME
+
 
 /*----------------------------------------------------------------------------*/
 /*                                                                            */
@@ -26,6 +26,16 @@
 /*------------------------------------------------------------------------*/
 void (*SPI_StcCallBack)(void);
 
+/*!< Transfer in the background, see SPI_Transfer() */
+static const u8_t * SPI_TxBuffer = NULL;
+static u8_t * SPI_RxBuffer = NULL;
+static u16_t SPI_TransferLength = 0;
+static u16_t SPI_TransferIndex = 0;                 /*!< Index of the byte being transferred */
+static void (* SPI_TransferCallback)(void) = NULL;
+static volatile u8_t SPI_IsTransferring = 0;
+static u8_t SPI_WasInterruptEnabled = 0;            /*!< SPIE before the transfer */
+static u8_t SPI_IsInTransferCallback = 0;           /*!< The callback of a transfer is running (in the ISR) */
+
 /*------------------------------------------------------------------------*/
 /*                                                                        */
 /*                    PRIVATE Functions Prototypes                        */
@@ -39,6 +49,7 @@ static void SPI_SlaveInit(void);
 static void SPI_SetMode(void);
 static void SPI_SetDataOrder(void);
 static void SPI_SetClockMode(void);
+static void SPI_TransferComplete(void);
 
 /*------------------------------------------------------------------------*/
 /*                                                                        */
@@ -84,6 +95,10 @@ ERROR_t SPI_SendByte(const u8_t data) {
     ERROR_t error = ERROR_OK;
     u8_t volatile fBuffer = 0;
 
+    if(SPI_IsTransferring) {
+        return ERROR_BUSY;
+    }
+
     SPDR = data;                        /* Write data to the SPI data register */
 
     while(BIT_IS_CLEAR(SPSR, SPIF));    /* Wait until SPI transfer complete */
@@ -105,18 +120,23 @@ ERROR_t SPI_Available(STATE_t * const ptrToState) {
 
 ERROR_t SPI_ReceiveByte(u8_t * const data) {
     ERROR_t error = ERROR_OK;
-	u32_t u32Timeout = 10000000;
-	
-	/* Send garbage value	*/
-	SPDR = NULL_BYTE;		
+    u32_t u32Timeout = 10000000;
+    u8_t volatile fBuffer = 0;
 
-	/* Wait for transmission complete   */
+    if(SPI_IsTransferring) {
+        return ERROR_BUSY;
+    }
+    
+    /* Send garbage value	*/
+    SPDR = NULL_BYTE;		
+
+    /* Wait for transmission complete   */
     while(BIT_IS_CLEAR(SPSR, SPIF) && (--u32Timeout));               
     
-	/* Read data from buffer, and clear the SPIF flag by accessing both SPSR, and SPDR registers	*/
-	fBuffer = SPSR; 					/* Read SPI Status register */
+    /* Read data from buffer, and clear the SPIF flag by accessing both SPSR, and SPDR registers	*/
+    fBuffer = SPSR; 					/* Read SPI Status register */
     *data = SPDR;
-	
+    
     return error;
 }
 
@@ -128,11 +148,149 @@ ERROR_t SPI_Read(u8_t * const data) {
     return error;
 }
 
-void SPI_TrancieveByte(const u8_t dataToSend, u8_t * const dataReceived) {   
+ERROR_t SPI_TrancieveByte(const u8_t dataToSend, u8_t * const dataReceived) {   
+    if(SPI_IsTransferring) {
+        return ERROR_BUSY;
+    }
+
     SPDR = dataToSend;  /* Send dummy data to receive data from slave */
 
     while(BIT_IS_CLEAR(SPSR, SPIF));      /* Wait for transmission complete   */
     *dataReceived = SPDR;             /* Read data from buffer            */
+
+    return ERROR_OK;
+}
+
+ERROR_t SPI_Transfer(const u8_t * const txBuffer, u8_t * const rxBuffer, const u16_t length,
+                     void (* const callback)(void)) {
+    u8_t u8_tSreg = 0;
+    u8_t volatile fBuffer = 0;
+
+    if(0 == length) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+
+    if(SPI_IsTransferring) {
+        SREG = u8_tSreg;
+        return ERROR_BUSY;
+    }
+
+    SPI_TxBuffer            = txBuffer;
+    SPI_RxBuffer            = rxBuffer;
+    SPI_TransferLength      = length;
+    SPI_TransferIndex       = 0;
+    SPI_TransferCallback    = callback;
+    SPI_WasInterruptEnabled = BIT_IS_SET(SPCR, SPIE) ? 1 : 0;
+    SPI_IsTransferring      = 1;
+
+    /* Clear a flag left by a polled transfer: it would run the ISR now */
+    fBuffer = SPSR;
+    fBuffer = SPDR;
+    (void)fBuffer;
+
+    BIT_SET(SPCR, SPIE);
+    SPDR = (NULL != txBuffer) ? txBuffer[0] : SPI_DUMMY_BYTE;
+
+    /* A transfer chained from the callback must not enable the nesting of
+       the ISR: the interrupts are enabled again when the ISR returns */
+    if(SPI_IsInTransferCallback) {
+        SREG = u8_tSreg;
+    } else {
+        GIE_Enable();
+    }
+
+    return ERROR_OK;
+}
+
+ERROR_t SPI_Burst(const u8_t * txBuffer, u8_t * rxBuffer, u16_t length) {
+    const u8_t spcr = SPCR;
+    const u8_t spsr = SPSR;
+    u8_t volatile fBuffer = 0;
+    u8_t received = 0;
+    u8_t next = 0;
+
+    if(SPI_IsTransferring) {
+        return ERROR_BUSY;
+    }
+
+    if(0 == length) {
+        return ERROR_OK;
+    }
+
+    /* The ISR would clear SPIF before the loop sees it */
+    BIT_CLR(SPCR, SPIE);
+
+#if (SPI_BURST_MAX_SPEED)
+    if(BIT_IS_SET(spcr, MSTR)) {
+        SPCR &= ~((1 << SPR1) | (1 << SPR0));
+        BIT_SET(SPSR, SPI2X);
+    }
+#endif
+
+    /* Clear a flag left by the last transfer */
+    fBuffer = SPSR;
+    fBuffer = SPDR;
+    (void)fBuffer;
+
+    /* One loop per case: no test of the buffers per byte. The next byte is
+       read from RAM while the current one is shifted out */
+    if( (NULL != txBuffer) && (NULL != rxBuffer) ) {
+        SPDR = *txBuffer++;
+        while(--length) {
+            next = *txBuffer++;
+            while(BIT_IS_CLEAR(SPSR, SPIF));
+            received = SPDR;
+            SPDR = next;
+            *rxBuffer++ = received;
+        }
+    } else if(NULL != txBuffer) {
+        SPDR = *txBuffer++;
+        while(--length) {
+            next = *txBuffer++;
+            while(BIT_IS_CLEAR(SPSR, SPIF));
+            (void)SPDR;
+            SPDR = next;
+        }
+    } else if(NULL != rxBuffer) {
+        SPDR = SPI_DUMMY_BYTE;
+        while(--length) {
+            while(BIT_IS_CLEAR(SPSR, SPIF));
+            received = SPDR;
+            SPDR = SPI_DUMMY_BYTE;
+            *rxBuffer++ = received;
+        }
+    } else {
+        SPDR = SPI_DUMMY_BYTE;
+        while(--length) {
+            while(BIT_IS_CLEAR(SPSR, SPIF));
+            (void)SPDR;
+            SPDR = SPI_DUMMY_BYTE;
+        }
+    }
+
+    while(BIT_IS_CLEAR(SPSR, SPIF));
+    received = SPDR;
+    if(NULL != rxBuffer) {
+        *rxBuffer = received;
+    }
+
+    SPSR = spsr;
+    SPCR = spcr;
+
+    return ERROR_OK;
+}
+
+ERROR_t SPI_IsTransferComplete(STATE_t * const ptrToState) {
+    if(NULL == ptrToState) {
+        return ERROR_NULL_POINTER;
+    }
+
+    *ptrToState = SPI_IsTransferring ? LOW : HIGH;
+
+    return ERROR_OK;
 }
 
 /*------------------------------------------------------------------------*/
@@ -140,16 +298,34 @@ void SPI_TrancieveByte(const u8_t dataToSend, u8_t * const dataReceived) {
 /*                          ISR FUNCTIONS                                 */
 /*                                                                        */
 /*------------------------------------------------------------------------*/
+#if (SPI_HANDLERS_BINDING == BINDING_STATIC)
+/* Bound at link time: the application overrides it */
+void SPI_STC_Handler(void) __attribute__((weak));
+void SPI_STC_Handler(void) {
+    /* DEBUG: No handler defined */
+}
+#endif
+
 /* SPI_STC_ISR */
 void __vector_17(void) __attribute__((signal));
 void __vector_17(void) {
+    /* First, so the next byte of a transfer is sent with the least delay */
+    if(SPI_IsTransferring) {
+        SPI_TransferComplete();
+        return;
+    }
+
     GIE_Disable();
 
+#if (SPI_HANDLERS_BINDING == BINDING_STATIC)
+    SPI_STC_Handler();
+#else
     if(SPI_StcCallBack != NULL) {
         SPI_StcCallBack();
     } else {
         /* DEBUG: No callback function defined */
     }
+#endif
 
     BIT_SET(SPSR, SPIF);        /* Clear SPI interrupt flag */
 
@@ -162,6 +338,37 @@ void __vector_17(void) {
 /*                                                                        */
 /*------------------------------------------------------------------------*/
 
+/*********************************************************************
+ * @brief Transfer complete ISR of SPI_Transfer(): the flag is cleared
+ *        by the hardware. The next byte is written before the received
+ *        one is stored, so the bus idles as little as possible.
+ *********************************************************************/
+static void SPI_TransferComplete(void) {
+    const u8_t received = SPDR;
+    const u16_t index = SPI_TransferIndex;
+    const u16_t next = index + 1;
+
+    if(next < SPI_TransferLength) {
+        SPDR = (NULL != SPI_TxBuffer) ? SPI_TxBuffer[next] : SPI_DUMMY_BYTE;
+        SPI_TransferIndex = next;
+    } else {
+        if(!SPI_WasInterruptEnabled) {
+            BIT_CLR(SPCR, SPIE);
+        }
+        SPI_IsTransferring = 0;
+    }
+
+    if(NULL != SPI_RxBuffer) {
+        SPI_RxBuffer[index] = received;
+    }
+
+    if( (next >= SPI_TransferLength) && (NULL != SPI_TransferCallback) ) {
+        SPI_IsInTransferCallback = 1;
+        SPI_TransferCallback();
+        SPI_IsInTransferCallback = 0;
+    }
+}
+
 /*********************************************************************
  * @brief Set Clock Prescaler for SPI module 
  *********************************************************************/
@@ -233,14 +440,14 @@ static void SPI_Disable(void) {
  ****************************************************************************/
 static void SPI_MasterInit(void) {
     /* Configure pins */
-    DIO_InitPin(SPI_Config.connections.SS.pin  , SPI_Config.connections.SS.port    , DIO_OUTPUT , DIO_PULLUP_OFF);
-    DIO_InitPin(SPI_Config.connections.MOSI.pin, SPI_Config.connections.MOSI.port  , DIO_OUTPUT , DIO_PULLUP_OFF);
-    DIO_InitPin(SPI_Config.connections.MISO.pin, SPI_Config.connections.MISO.port  , DIO_INPUT  , DIO_PULLUP_OFF);
-    DIO_InitPin(SPI_Config.connections.SCK.pin , SPI_Config.connections.SCK.port   , DIO_OUTPUT , DIO_PULLUP_OFF);
+    DIO_InitPin(SPI_Config.connections.SS  , DIO_OUTPUT , DIO_PULLUP_OFF);
+    DIO_InitPin(SPI_Config.connections.MOSI, DIO_OUTPUT , DIO_PULLUP_OFF);
+    DIO_InitPin(SPI_Config.connections.MISO, DIO_INPUT  , DIO_PULLUP_OFF);
+    DIO_InitPin(SPI_Config.connections.SCK , DIO_OUTPUT , DIO_PULLUP_OFF);
 
     /* Sending Falling Edge on the SS pin */
-    DIO_SetPinValue(SPI_Config.connections.SS.pin, SPI_Config.connections.SS.port, HIGH);
-    DIO_SetPinValue(SPI_Config.connections.SS.pin, SPI_Config.connections.SS.port, LOW);
+    DIO_SetPinValue(SPI_Config.connections.SS, HIGH);
+    DIO_SetPinValue(SPI_Config.connections.SS, LOW);
 
     /* Set Master mode */
     BIT_SET(SPCR, MSTR);
@@ -252,10 +459,10 @@ static void SPI_MasterInit(void) {
  ****************************************************************************/
 static void SPI_SlaveInit(void) {
     /* Configure pins */
-    DIO_InitPin(SPI_Config.connections.SS.pin  , SPI_Config.connections.SS.port    , DIO_INPUT  , DIO_PULLUP_OFF);
-    DIO_InitPin(SPI_Config.connections.MOSI.pin, SPI_Config.connections.MOSI.port  , DIO_INPUT  , DIO_PULLUP_OFF);
-    DIO_InitPin(SPI_Config.connections.MISO.pin, SPI_Config.connections.MISO.port  , DIO_OUTPUT , DIO_PULLUP_OFF);
-    DIO_InitPin(SPI_Config.connections.SCK.pin , SPI_Config.connections.SCK.port   , DIO_INPUT  , DIO_PULLUP_OFF);
+    DIO_InitPin(SPI_Config.connections.SS  , DIO_INPUT  , DIO_PULLUP_OFF);
+    DIO_InitPin(SPI_Config.connections.MOSI, DIO_INPUT  , DIO_PULLUP_OFF);
+    DIO_InitPin(SPI_Config.connections.MISO, DIO_OUTPUT , DIO_PULLUP_OFF);
+    DIO_InitPin(SPI_Config.connections.SCK , DIO_INPUT  , DIO_PULLUP_OFF);
 
     /* Set Slave mode */
     BIT_CLR(SPCR, MSTR);
@@ -70,8 +70,63 @@ ERROR_t SPI_Read(u8_t * const data);
  * @note        The function is blocking because the SPI module is not designed 
  *              to be used in interrupt mode and the function blocks until the 
  *              byte is sent and received from the SPI module.
+ * @return      ERROR_t: ERROR_BUSY if a transfer of SPI_Transfer() is in
+ *              progress. Nothing is sent.
  ******************************************************************************/
-void SPI_TrancieveByte(const u8_t dataToSend, u8_t * const dataReceived);
+ERROR_t SPI_TrancieveByte(const u8_t dataToSend, u8_t * const dataReceived);
+
+/*******************************************************************************
+ * @brief       Sends and receives a block of bytes in the background, one
+ *              byte per serial transfer complete interrupt.
+ * @param[in]   txBuffer: Bytes to send. NULL to send SPI_DUMMY_BYTE (see
+ *              SPI_cfg.h), to read a device.
+ * @param[out]  rxBuffer: Received bytes. NULL to drop them, to write a device.
+ * @param[in]   length: Number of bytes, 1 to 65535.
+ * @param[in]   callback: Called from the ISR when the last byte is received.
+ *              Can be NULL, then poll SPI_IsTransferComplete(). The next
+ *              transfer can be started from the callback.
+ * @return      Error status: \ref ERROR_t
+ *              - ERROR_BUSY: A transfer is in progress.
+ * @note        The buffers must stay valid until the end of the transfer, and
+ *              txBuffer and rxBuffer can be the same buffer.
+ * @note        The function does not block, and enables the global interrupt
+ *              (except when it is called from the callback of a transfer).
+ *              The chip select of the device is handled by the caller: keep
+ *              it active until the callback.
+ * @note        In slave mode the bytes are exchanged when the master clocks
+ *              them.
+ ******************************************************************************/
+ERROR_t SPI_Transfer(const u8_t * const txBuffer, u8_t * const rxBuffer, const u16_t length,
+                     void (* const callback)(void));
+
+/*******************************************************************************
+ * @brief       Checks if the last transfer started by SPI_Transfer() is done.
+ * @param[out]  ptrToState: HIGH when done (or no transfer), LOW otherwise.
+ * @return      Error status: \ref ERROR_t
+ ******************************************************************************/
+ERROR_t SPI_IsTransferComplete(STATE_t * const ptrToState);
+
+/*******************************************************************************
+ * @brief       Sends and receives a block of bytes as fast as the bus allows,
+ *              polling the transfer complete flag (master mode).
+ * @param[in]   txBuffer: Bytes to send. NULL to send SPI_DUMMY_BYTE.
+ * @param[out]  rxBuffer: Received bytes. NULL to drop them.
+ * @param[in]   length: Number of bytes.
+ * @return      Error status: \ref ERROR_t
+ *              - ERROR_BUSY: A transfer of SPI_Transfer() is in progress.
+ * @note        The function blocks until the last byte is received. With
+ *              SPI_BURST_MAX_SPEED (see SPI_cfg.h) the bus runs at F_CPU / 2
+ *              during the burst, and the configured clock is restored after.
+ * @note        Cost per byte (counted from the instructions, not measured on
+ *              the target):
+ *              - SPI_Burst() at F_CPU / 2: about 20 cycles, the 16 cycles of
+ *                the byte and 3 to 4 cycles from SPIF to the next write.
+ *              - SPI_SendString() at F_CPU / 2: about 60 cycles, the call of
+ *                SPI_SendByte() and the error check of each byte.
+ *              Use it for short transfers, where an interrupt per byte
+ *              (SPI_Transfer()) costs more than the byte.
+ ******************************************************************************/
+ERROR_t SPI_Burst(const u8_t * txBuffer, u8_t * rxBuffer, u16_t length);
 
 /*******************************************************************************
  * @brief       Enables the Interrupts for the SPI module
@@ -83,4 +138,11 @@ void SPI_EnableInterrupt(void(*ptrCallback)(void));
  ******************************************************************************/
 void SPI_DisableInterrupt(void);
 
+/******************************************************************************
+ * @brief   Called by the transfer complete ISR instead of the callback when
+ *          SPI_HANDLERS_BINDING is BINDING_STATIC (see SPI_cfg.h). It is weak
+ *          and empty in SPI.c.
+ *****************************************************************************/
+void SPI_STC_Handler(void);
+
 #endif      /* SPI_H */
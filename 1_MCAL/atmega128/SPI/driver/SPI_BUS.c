@@ -0,0 +1,364 @@
+/**************************************************************************
+ * @file        SPI_BUS.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Sharing of the SPI bus between devices with different
+ *              settings and chip selects.
+ * @details     The SPCR and SPSR values of each device are computed once by
+ *              \ref SPI_BUS_Init. \ref SPI_BUS_Select writes them only when
+ *              the selected device is not the last one, so a driver that
+ *              talks to its device many times in a row does not pay for the
+ *              configuration. The chip selects are driven through their PORT
+ *              register (see \ref DIO_GetPinRegister).
+ *
+ *              \ref SPI_BUS_Queue keeps the transactions sorted by priority.
+ *              The transfer complete callback of \ref SPI_Transfer releases
+ *              the chip select and starts the next transaction before it
+ *              calls the callback of the finished one, so the bus idles only
+ *              for the time of the select.
+ * @version     1.0.0
+ * @date        2022-08-12
+ * @copyright   Copyright (c) 2022
+ ***************************************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "SPI_reg.h"
+#include "DIO.h"
+#include "DIO_cfg.h"
+#include "GIE.h"
+#include "SPI.h"
+#include "SPI_cfg.h"
+#include "SPI_BUS.h"
+#include "SPI_BUS_cfg.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                      PRIVATE FUNCTIONS PROTOTYPES                            */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static void SPI_BUS_Activate(const SPI_DEVICE_t device);
+static void SPI_BUS_Release(const SPI_DEVICE_t device);
+static void SPI_BUS_StartNext(void);
+static void SPI_BUS_TransactionComplete(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE VARIABLES                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static u8_t SPI_BUS_Spcr[NUM_OF_SPI_DEVICES];
+static u8_t SPI_BUS_Spsr[NUM_OF_SPI_DEVICES];
+static volatile u8_t * SPI_BUS_CsPorts[NUM_OF_SPI_DEVICES];
+static u8_t SPI_BUS_CsMasks[NUM_OF_SPI_DEVICES];
+static u8_t SPI_BUS_IsInitialized = 0;
+
+static SPI_DEVICE_t SPI_BUS_ConfiguredDevice = NUM_OF_SPI_DEVICES;     /*!< Device of SPCR and SPSR */
+static SPI_DEVICE_t SPI_BUS_SelectedDevice = NUM_OF_SPI_DEVICES;       /*!< NUM_OF_SPI_DEVICES if none */
+
+/*!< A transaction of SPI_BUS_Queue() */
+typedef struct {
+    const u8_t *        txBuffer;
+    u8_t *              rxBuffer;
+    u16_t               length;
+    SPI_DEVICE_t        device;
+    SPI_BUS_PRIORITY_t  priority;
+    void (* callback)(void);
+} SPI_BUS_TRANSACTION_t;
+
+static SPI_BUS_TRANSACTION_t SPI_BUS_Transactions[SPI_BUS_QUEUE_LENGTH];
+static u8_t SPI_BUS_Order[SPI_BUS_QUEUE_LENGTH];        /*!< Waiting transactions, highest priority first */
+static volatile u8_t SPI_BUS_CountWaiting = 0;
+static volatile u8_t SPI_BUS_UsedSlots = 0;             /*!< Bit of each used transaction, waiting or in progress */
+static u8_t SPI_BUS_CurrentSlot = 0;                    /*!< Transaction in progress */
+static volatile u8_t SPI_BUS_IsRunning = 0;             /*!< The queue owns the bus */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PUBLIC FUNCTIONS                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+ERROR_t SPI_BUS_Init(void) {
+    ERROR_t error = ERROR_OK;
+    SPI_DEVICE_t device = NUM_OF_SPI_DEVICES;
+    u8_t prescaler = 0;
+    u8_t i = 0;
+
+    if(SPI_BUS_IsInitialized) {
+        return ERROR_OK;
+    }
+
+    if(countSpiDevicesConfigured > NUM_OF_SPI_DEVICES) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    SPI_Init();
+
+    for(i = 0; (ERROR_OK == error) && (i < countSpiDevicesConfigured); ++i) {
+        device = spiBusDeviceConfigs[i].device;
+        if(device >= NUM_OF_SPI_DEVICES) {
+            error |= ERROR_INVALID_PARAMETER;
+            break;
+        }
+
+        error |= DIO_GetPinRegister(spiBusDeviceConfigs[i].chipSelect, &SPI_BUS_CsPorts[device],
+                                    &SPI_BUS_CsMasks[device]);
+        error |= DIO_SetPinValue(spiBusDeviceConfigs[i].chipSelect, HIGH);
+
+        /*!< SPI_PRESCALER_t n is F_CPU / 2^(n + 1). As in SPI_SetClockPrescaler():
+             SPR1:0 = n / 2 selects /4, /16, /64 or /128, and SPI2X halves it
+             for the even n (/2, /8, /32). /128 has no SPI2X: SPR1:0 = 11 alone */
+        prescaler = spiBusDeviceConfigs[i].clockDivider;
+        SPI_BUS_Spcr[device] = (u8_t)((1 << SPE) | (1 << MSTR) |
+                                      ((u8_t)spiBusDeviceConfigs[i].clockMode << CPHA) |
+                                      ((SPI_DATA_ORDER_LSB_FIRST == spiBusDeviceConfigs[i].dataOrder) ? (1 << DORD) : 0) |
+                                      ((SPI_PRESCALER_128 == prescaler) ? 0x03 : (prescaler >> 1)));
+        SPI_BUS_Spsr[device] = ( (0 == (prescaler & 0x01)) && (SPI_PRESCALER_128 != prescaler) ) ? (1 << SPI2X) : 0;
+    }
+
+    if(ERROR_OK == error) {
+        SPI_BUS_ConfiguredDevice = NUM_OF_SPI_DEVICES;
+        SPI_BUS_SelectedDevice = NUM_OF_SPI_DEVICES;
+        SPI_BUS_IsInitialized = 1;
+    }
+
+    return error;
+}
+
+ERROR_t SPI_BUS_Select(const SPI_DEVICE_t device) {
+    ERROR_t error = ERROR_OK;
+    u8_t u8_tSreg = 0;
+
+    if(device >= NUM_OF_SPI_DEVICES) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    if(!SPI_BUS_IsInitialized) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    if(NULL == SPI_BUS_CsPorts[device]) {
+        return ERROR_INVALID_PARAMETER;         /*!< Not in spiBusDeviceConfigs */
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+
+    /*!< Not nested: a select of the selected device would merge two frames */
+    if( SPI_BUS_IsRunning || (NUM_OF_SPI_DEVICES != SPI_BUS_SelectedDevice) ) {
+        error |= ERROR_BUSY;
+    } else {
+        SPI_BUS_Activate(device);
+    }
+
+    SREG = u8_tSreg;
+
+    return error;
+}
+
+ERROR_t SPI_BUS_Deselect(const SPI_DEVICE_t device) {
+    ERROR_t error = ERROR_OK;
+    u8_t u8_tSreg = 0;
+    u8_t isQueueToStart = 0;
+
+    if(device >= NUM_OF_SPI_DEVICES) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+
+    if( (device != SPI_BUS_SelectedDevice) || SPI_BUS_IsRunning ) {
+        error |= ERROR_INVALID_PARAMETER;
+    } else {
+        SPI_BUS_Release(device);
+
+        /*!< Transactions were queued while the bus was used */
+        if(0 != SPI_BUS_CountWaiting) {
+            SPI_BUS_IsRunning = 1;
+            isQueueToStart = 1;
+        }
+    }
+
+    SREG = u8_tSreg;
+
+    if(isQueueToStart) {
+        SPI_BUS_StartNext();
+    }
+
+    return error;
+}
+
+ERROR_t SPI_BUS_Transfer(const SPI_DEVICE_t device, const u8_t * const txBuffer,
+                         u8_t * const rxBuffer, const u16_t length) {
+    ERROR_t error = ERROR_OK;
+
+    error |= SPI_BUS_Select(device);
+
+    if(ERROR_OK == error) {
+        error |= SPI_Burst(txBuffer, rxBuffer, length);
+        error |= SPI_BUS_Deselect(device);
+    }
+
+    return error;
+}
+
+ERROR_t SPI_BUS_Queue(const SPI_DEVICE_t device, const u8_t * const txBuffer, u8_t * const rxBuffer,
+                      const u16_t length, const SPI_BUS_PRIORITY_t priority, void (* const callback)(void)) {
+    ERROR_t error = ERROR_OK;
+    SPI_BUS_TRANSACTION_t * transaction = NULL;
+    u8_t u8_tSreg = 0;
+    u8_t isQueueToStart = 0;
+    u8_t slot = 0;
+    u8_t i = 0;
+
+    if( (device >= NUM_OF_SPI_DEVICES) || (priority >= NUM_OF_SPI_BUS_PRIORITIES) || (0 == length) ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    if(!SPI_BUS_IsInitialized) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    if(NULL == SPI_BUS_CsPorts[device]) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+
+    for(slot = 0; (slot < SPI_BUS_QUEUE_LENGTH) && (0 != BIT_IS_SET(SPI_BUS_UsedSlots, slot)); ++slot);
+
+    if(slot >= SPI_BUS_QUEUE_LENGTH) {
+        error |= ERROR_BUSY;
+    } else {
+        transaction = &SPI_BUS_Transactions[slot];
+        transaction->txBuffer = txBuffer;
+        transaction->rxBuffer = rxBuffer;
+        transaction->length   = length;
+        transaction->device   = device;
+        transaction->priority = priority;
+        transaction->callback = callback;
+        BIT_SET(SPI_BUS_UsedSlots, slot);
+
+        /*!< Insert it after the transactions of the same or a higher priority */
+        for(i = SPI_BUS_CountWaiting; (i > 0) && (SPI_BUS_Transactions[SPI_BUS_Order[i - 1]].priority < priority); --i) {
+            SPI_BUS_Order[i] = SPI_BUS_Order[i - 1];
+        }
+        SPI_BUS_Order[i] = slot;
+        ++SPI_BUS_CountWaiting;
+
+        if( !SPI_BUS_IsRunning && (NUM_OF_SPI_DEVICES == SPI_BUS_SelectedDevice) ) {
+            SPI_BUS_IsRunning = 1;
+            isQueueToStart = 1;
+        }
+    }
+
+    SREG = u8_tSreg;
+
+    if(isQueueToStart) {
+        SPI_BUS_StartNext();
+    }
+
+    return error;
+}
+
+ERROR_t SPI_BUS_GetQueueCount(u8_t * const ptrToCount) {
+    u8_t count = 0;
+    u8_t slots = SPI_BUS_UsedSlots;
+
+    if(NULL == ptrToCount) {
+        return ERROR_NULL_POINTER;
+    }
+
+    for(; 0 != slots; slots >>= 1) {
+        count += slots & 0x01;
+    }
+    *ptrToCount = count;
+
+    return ERROR_OK;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE FUNCTIONS                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**************************************************************************
+ * @brief  Apply the settings of a device if needed, and select it. Called
+ *         with the interrupts disabled, or from the ISR.
+ *************************************************************************/
+static void SPI_BUS_Activate(const SPI_DEVICE_t device) {
+    if(device != SPI_BUS_ConfiguredDevice) {
+        /*!< Keep SPIE: an interrupt user may be registered */
+        SPCR = SPI_BUS_Spcr[device] | (SPCR & (1 << SPIE));
+        SPSR = SPI_BUS_Spsr[device];
+        SPI_BUS_ConfiguredDevice = device;
+    }
+
+    SPI_BUS_SelectedDevice = device;
+    *SPI_BUS_CsPorts[device] &= ~SPI_BUS_CsMasks[device];
+}
+
+static void SPI_BUS_Release(const SPI_DEVICE_t device) {
+    *SPI_BUS_CsPorts[device] |= SPI_BUS_CsMasks[device];
+    SPI_BUS_SelectedDevice = NUM_OF_SPI_DEVICES;
+}
+
+/**************************************************************************
+ * @brief  Start the first waiting transaction, or stop the queue if there
+ *         is none. SPI_BUS_IsRunning must be set by the caller.
+ *************************************************************************/
+static void SPI_BUS_StartNext(void) {
+    const SPI_BUS_TRANSACTION_t * transaction = NULL;
+    u8_t u8_tSreg = SREG;
+    u8_t i = 0;
+
+    GIE_Disable();
+
+    if(0 == SPI_BUS_CountWaiting) {
+        SPI_BUS_IsRunning = 0;
+    } else {
+        SPI_BUS_CurrentSlot = SPI_BUS_Order[0];
+        --SPI_BUS_CountWaiting;
+        for(i = 0; i < SPI_BUS_CountWaiting; ++i) {
+            SPI_BUS_Order[i] = SPI_BUS_Order[i + 1];
+        }
+
+        transaction = &SPI_BUS_Transactions[SPI_BUS_CurrentSlot];
+        SPI_BUS_Activate(transaction->device);
+
+        if(ERROR_OK != SPI_Transfer(transaction->txBuffer, transaction->rxBuffer, transaction->length,
+                                    SPI_BUS_TransactionComplete)) {
+            /*!< SPI_Transfer() was used without the bus: put it back, the
+                 queue starts again on the next SPI_BUS_Queue() */
+            SPI_BUS_Release(transaction->device);
+            for(i = SPI_BUS_CountWaiting; i > 0; --i) {
+                SPI_BUS_Order[i] = SPI_BUS_Order[i - 1];
+            }
+            SPI_BUS_Order[0] = SPI_BUS_CurrentSlot;
+            ++SPI_BUS_CountWaiting;
+            SPI_BUS_IsRunning = 0;
+        }
+    }
+
+    SREG = u8_tSreg;
+}
+
+/**************************************************************************
+ * @brief  Callback of SPI_Transfer(), in the ISR: release the device, start
+ *         the next transaction, then call the callback of this one.
+ *************************************************************************/
+static void SPI_BUS_TransactionComplete(void) {
+    const SPI_BUS_TRANSACTION_t * transaction = &SPI_BUS_Transactions[SPI_BUS_CurrentSlot];
+    void (* const callback)(void) = transaction->callback;
+
+    SPI_BUS_Release(transaction->device);
+    BIT_CLR(SPI_BUS_UsedSlots, SPI_BUS_CurrentSlot);
+
+    SPI_BUS_StartNext();
+
+    if(NULL != callback) {
+        callback();
+    }
+}
@@ -0,0 +1,121 @@
+/******************************************************************************
+ * @file            SPI_BUS.h
+ * @author          Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief           Interfaces header file for \ref SPI_BUS.c
+ * @version         1.0.0
+ * @date            2022-08-12
+ * PRECONDITIONS:   - SPI.c and DIO.c must be included in the project
+ *                  - The chip selects are configured in DIO_cfg.c
+ * @copyright       Copyright (c) 2022
+ ******************************************************************************/
+#ifndef SPI_BUS_H
+#define SPI_BUS_H
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Names of the devices on the SPI bus. Change it to your needs, and
+ *          configure each device in SPI_BUS_cfg.c
+ ******************************************************************************/
+typedef enum {
+    SPI_DEVICE_NRF24,
+    SPI_DEVICE_FLASH,
+    SPI_DEVICE_DISPLAY,
+    NUM_OF_SPI_DEVICES
+} SPI_DEVICE_t;
+
+/******************************************************************************
+ * @brief   Priority of a queued transaction (see \ref SPI_BUS_Queue).
+ ******************************************************************************/
+typedef enum {
+    SPI_BUS_PRIORITY_LOW,           /*!< Bulk transfers: logging */
+    SPI_BUS_PRIORITY_NORMAL,
+    SPI_BUS_PRIORITY_HIGH,          /*!< Latency critical: radio */
+    NUM_OF_SPI_BUS_PRIORITIES
+} SPI_BUS_PRIORITY_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                             API FUNCTIONS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief       Initialize the SPI module in master mode (\ref SPI_Init), and
+ *              deselect all the devices.
+ * @return      ERROR_t: ERROR_INVALID_PARAMETER if a chip select is not
+ *              configured in DIO_cfg.c.
+ * @note        It can be called by the driver of each device: it does nothing
+ *              the second time.
+ ******************************************************************************/
+ERROR_t SPI_BUS_Init(void);
+
+/*******************************************************************************
+ * @brief       Select a device: apply its settings if the last selected device
+ *              was another one, and drive its chip select LOW.
+ * @param[in]   device: The device to select.
+ * @return      ERROR_t:
+ *              - ERROR_BUSY: A device (this one included) is selected, or
+ *                the queue of \ref SPI_BUS_Queue is running.
+ *              - ERROR_NOT_INITIALIZED: SPI_BUS_Init() was not called.
+ * @note        Selects are not nested: the chip select LOW to HIGH is one
+ *              frame, many devices end a command on the chip select HIGH.
+ ******************************************************************************/
+ERROR_t SPI_BUS_Select(const SPI_DEVICE_t device);
+
+/*******************************************************************************
+ * @brief       Release the select of \ref SPI_BUS_Select: chip select HIGH.
+ * @param[in]   device: The selected device.
+ * @return      ERROR_t: ERROR_INVALID_PARAMETER if the device is not selected.
+ * @note        The queue of \ref SPI_BUS_Queue starts when the bus is free.
+ ******************************************************************************/
+ERROR_t SPI_BUS_Deselect(const SPI_DEVICE_t device);
+
+/*******************************************************************************
+ * @brief       Select a device, transfer a block with \ref SPI_Burst, and
+ *              deselect it.
+ * @param[in]   device: The device.
+ * @param[in]   txBuffer: Bytes to send, NULL to send SPI_DUMMY_BYTE.
+ * @param[out]  rxBuffer: Received bytes, NULL to drop them.
+ * @param[in]   length: Number of bytes.
+ * @return      ERROR_t
+ ******************************************************************************/
+ERROR_t SPI_BUS_Transfer(const SPI_DEVICE_t device, const u8_t * const txBuffer,
+                         u8_t * const rxBuffer, const u16_t length);
+
+/*******************************************************************************
+ * @brief       Queue a transaction: select the device, transfer a block with
+ *              \ref SPI_Transfer and deselect it, in the background.
+ * @param[in]   device: The device.
+ * @param[in]   txBuffer: Bytes to send, NULL to send SPI_DUMMY_BYTE.
+ * @param[out]  rxBuffer: Received bytes, NULL to drop them.
+ * @param[in]   length: Number of bytes, 1 to 65535.
+ * @param[in]   priority: The transactions of a higher priority are done
+ *              first, then the oldest one of the same priority.
+ * @param[in]   callback: Called from the ISR after the transaction, when the
+ *              next one is already started. Can be NULL.
+ * @return      ERROR_t:
+ *              - ERROR_BUSY: The queue is full (SPI_BUS_QUEUE_LENGTH).
+ *              - ERROR_NOT_INITIALIZED: SPI_BUS_Init() was not called.
+ * @note        The buffers must stay valid until the callback.
+ * @note        A transaction is not interrupted by a higher priority one:
+ *              split long bulk transfers (a flash page per transaction), so
+ *              the radio does not wait long.
+ * @note        Transactions can be queued from a callback. The global
+ *              interrupt must be enabled.
+ ******************************************************************************/
+ERROR_t SPI_BUS_Queue(const SPI_DEVICE_t device, const u8_t * const txBuffer, u8_t * const rxBuffer,
+                      const u16_t length, const SPI_BUS_PRIORITY_t priority, void (* const callback)(void));
+
+/*******************************************************************************
+ * @brief       Number of queued transactions, including the one in progress.
+ * @param[out]  ptrToCount: The number of transactions.
+ * @return      ERROR_t
+ ******************************************************************************/
+ERROR_t SPI_BUS_GetQueueCount(u8_t * const ptrToCount);
+
+#endif      /* SPI_BUS_H */
@@ -0,0 +1,43 @@
+/******************************************************************************
+ * @file        SPI_BUS_cfg.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Configuration source file for \ref SPI_BUS.c
+ * @version     1.0.0
+ * @date        2022-08-12
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "DIO_cfg.h"
+#include "SPI_cfg.h"
+#include "SPI_BUS.h"
+#include "SPI_BUS_cfg.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Settings of the devices on the SPI bus. They are applied by
+ *          SPI_BUS_Select() when the selected device changes.
+ * @details With F_CPU = 8 MHz:
+ *          - NRF24: mode 0, MSB first, up to 8 MHz.
+ *          - FLASH (W25Qxx): mode 0 or 3, MSB first, up to 50 MHz or more.
+ *          - DISPLAY: depends on the controller, 1 MHz here.
+ ******************************************************************************/
+const SPI_BUS_DEVICE_CONFIGS_t spiBusDeviceConfigs[] = {
+    {SPI_DEVICE_NRF24,      DIO_PINS_NRF24_CSN,     SPI_MODE0, SPI_DATA_ORDER_MSB_FIRST, SPI_PRESCALER_2},
+    {SPI_DEVICE_FLASH,      DIO_PINS_FLASH_CS,      SPI_MODE0, SPI_DATA_ORDER_MSB_FIRST, SPI_PRESCALER_2},
+    {SPI_DEVICE_DISPLAY,    DIO_PINS_DISPLAY_CS,    SPI_MODE3, SPI_DATA_ORDER_MSB_FIRST, SPI_PRESCALER_8},
+};
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+const u8_t countSpiDevicesConfigured = sizeof(spiBusDeviceConfigs) / sizeof(spiBusDeviceConfigs[0]);
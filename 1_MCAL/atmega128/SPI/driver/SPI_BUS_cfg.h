@@ -0,0 +1,58 @@
+/******************************************************************************
+ * @file        SPI_BUS_cfg.h
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Configuration header file for \ref SPI_BUS.c
+ * @version     1.0.0
+ * @date        2022-08-12
+ * PRECONDITIONS: SPI_cfg.h must be included before it
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#ifndef SPI_BUS_CFG_H
+#define SPI_BUS_CFG_H
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Number of transactions that can wait in the queue of
+ *          SPI_BUS_Queue(), including the one in progress (1 to 8).
+ ******************************************************************************/
+#define SPI_BUS_QUEUE_LENGTH        (8U)
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#if (SPI_BUS_QUEUE_LENGTH < 1) || (SPI_BUS_QUEUE_LENGTH > 8)
+#error "SPI_BUS_QUEUE_LENGTH is out of range"
+#endif
+
+/******************************************************************************
+ * @brief   This struct is used to pass the settings of a device on the SPI
+ *          bus to the APIs of the SPI_BUS module.
+ * @note    Members:
+ *          - SPI_DEVICE_t device: The name of the device.
+ *          - DIO_PINS_t chipSelect: Its chip select, active LOW, configured
+ *            as output in DIO_cfg.c.
+ *          - SPI_CLOCK_MODE_t clockMode: CPOL and CPHA of the device.
+ *          - SPI_DATA_ORDER_t dataOrder: MSB or LSB first.
+ *          - SPI_PRESCALER_t clockDivider: SCK = F_CPU / clockDivider.
+ *****************************************************************************/
+typedef struct {
+    SPI_DEVICE_t        device;
+    DIO_PINS_t          chipSelect;
+    SPI_CLOCK_MODE_t    clockMode;
+    SPI_DATA_ORDER_t    dataOrder;
+    SPI_PRESCALER_t     clockDivider;
+} SPI_BUS_DEVICE_CONFIGS_t;
+
+extern const SPI_BUS_DEVICE_CONFIGS_t spiBusDeviceConfigs[];
+extern const u8_t countSpiDevicesConfigured;
+
+#endif    /* SPI_BUS_CFG_H */
@@ -0,0 +1,233 @@
+/**************************************************************************
+ * @file        SPI_SLAVE.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Interrupt driven SPI slave serving a register map.
+ * @details     The transfer complete ISR handles each byte of a frame: the
+ *              first one is the address, the next ones are read from the
+ *              map or written to a ring buffer. The rising edge of SS, seen
+ *              on an external interrupt, ends the frame: the next byte is an
+ *              address again. The SPI hardware resets its bit counter on SS
+ *              HIGH, so the falling edge is not needed.
+ * @version     1.0.0
+ * @date        2022-08-14
+ * @copyright   Copyright (c) 2022
+ ***************************************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "SPI_reg.h"
+#include "DIO.h"
+#include "DIO_cfg.h"
+#include "GIE.h"
+#include "EXTI.h"
+#include "EXTI_cfg.h"
+#include "SPI.h"
+#include "SPI_cfg.h"
+#include "SPI_SLAVE.h"
+#include "SPI_SLAVE_cfg.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                      PRIVATE FUNCTIONS PROTOTYPES                            */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static void SPI_SLAVE_ByteComplete(void);
+static void SPI_SLAVE_FrameEnd(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE VARIABLES                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+typedef enum {
+    SPI_SLAVE_ADDRESS,      /*!< The next byte is an address */
+    SPI_SLAVE_READING,
+    SPI_SLAVE_WRITING
+} SPI_SLAVE_STATE_t;
+
+static u8_t SPI_SLAVE_Map[SPI_SLAVE_MAP_SIZE];
+static SPI_SLAVE_STATE_t SPI_SLAVE_State = SPI_SLAVE_ADDRESS;
+static u8_t SPI_SLAVE_Address = 0;                  /*!< Register of the next byte */
+static volatile u8_t SPI_SLAVE_IsInFrame = 0;       /*!< The address of a frame was received */
+static void (* SPI_SLAVE_FrameCallback)(void) = NULL;
+
+/*!< Writes of the master, read by SPI_SLAVE_GetWrite() */
+static u8_t SPI_SLAVE_WriteAddresses[SPI_SLAVE_WRITE_BUFFER_LENGTH];
+static u8_t SPI_SLAVE_WriteValues[SPI_SLAVE_WRITE_BUFFER_LENGTH];
+static volatile u8_t SPI_SLAVE_WriteHead = 0;       /*!< Next write to store (ISR) */
+static volatile u8_t SPI_SLAVE_WriteTail = 0;       /*!< Next write to read */
+static u16_t SPI_SLAVE_Overflows = 0;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PUBLIC FUNCTIONS                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+ERROR_t SPI_SLAVE_Init(void (* const frameCallback)(void)) {
+    if(SPI_SLAVE != SPI_Config.mode) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    SPI_Init();
+
+    GIE_Disable();
+    SPI_SLAVE_State = SPI_SLAVE_ADDRESS;
+    SPI_SLAVE_IsInFrame = 0;
+    SPI_SLAVE_WriteHead = 0;
+    SPI_SLAVE_WriteTail = 0;
+    SPI_SLAVE_FrameCallback = frameCallback;
+    SPDR = SPI_SLAVE_IDLE_BYTE;
+
+    EXTI_Init(SPI_SLAVE_SS_EXTI, RISING_EDGE, SPI_SLAVE_FrameEnd);     /*!< Enables GIE */
+    SPI_EnableInterrupt(SPI_SLAVE_ByteComplete);                        /*!< Enables GIE */
+
+    return ERROR_OK;
+}
+
+ERROR_t SPI_SLAVE_SetRegisters(const u8_t address, const u8_t * const data, const u8_t length) {
+    ERROR_t error = ERROR_OK;
+    u8_t u8_tSreg = 0;
+    u8_t i = 0;
+
+    if(NULL == data) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if( ((u16_t)address + length) > SPI_SLAVE_MAP_SIZE ) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+
+    if(SPI_SLAVE_IsInFrame) {
+        error |= ERROR_BUSY;
+    } else {
+        for(i = 0; i < length; ++i) {
+            SPI_SLAVE_Map[address + i] = data[i];
+        }
+    }
+
+    SREG = u8_tSreg;
+
+    return error;
+}
+
+ERROR_t SPI_SLAVE_GetWrite(u8_t * const ptrToAddress, u8_t * const ptrToValue) {
+    const u8_t tail = SPI_SLAVE_WriteTail;
+
+    if( (NULL == ptrToAddress) || (NULL == ptrToValue) ) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if(tail == SPI_SLAVE_WriteHead) {
+        return ERROR_NOK;
+    }
+
+    /*!< Only the ISR moves the head: the slot is read before it is freed */
+    *ptrToAddress = SPI_SLAVE_WriteAddresses[tail];
+    *ptrToValue = SPI_SLAVE_WriteValues[tail];
+    SPI_SLAVE_WriteTail = (tail + 1) & (SPI_SLAVE_WRITE_BUFFER_LENGTH - 1);
+
+    return ERROR_OK;
+}
+
+ERROR_t SPI_SLAVE_GetOverflows(u16_t * const ptrToOverflows) {
+    const u8_t u8_tSreg = SREG;
+
+    if(NULL == ptrToOverflows) {
+        return ERROR_NULL_POINTER;
+    }
+
+    GIE_Disable();
+    *ptrToOverflows = SPI_SLAVE_Overflows;
+    SREG = u8_tSreg;
+
+    return ERROR_OK;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          CALLBACKS OF THE ISRs                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+#if (SPI_HANDLERS_BINDING == BINDING_STATIC)
+/* Bound at link time: replaces the weak handler of SPI.c */
+void SPI_STC_Handler(void) {
+    SPI_SLAVE_ByteComplete();
+}
+#endif
+
+#if (EXTI_HANDLERS_BINDING == BINDING_STATIC)
+/* Bound at link time: replaces the weak EXTIn_Handler() of EXTI.c, the
+   callback given to EXTI_Init() is not used */
+void SPI_SLAVE_SS_HANDLER(void) {
+    SPI_SLAVE_FrameEnd();
+}
+#endif
+
+/**************************************************************************
+ * @brief  A byte of the frame is received: prepare the byte sent with the
+ *         next one first, then handle the received byte.
+ *************************************************************************/
+static void SPI_SLAVE_ByteComplete(void) {
+    const u8_t received = SPDR;
+    const u8_t address = SPI_SLAVE_Address;
+    u8_t head = 0;
+
+    switch(SPI_SLAVE_State) {
+        case SPI_SLAVE_ADDRESS:
+            SPI_SLAVE_IsInFrame = 1;
+            SPI_SLAVE_Address = received & ~SPI_SLAVE_WRITE;
+
+            if(0 != (received & SPI_SLAVE_WRITE)) {
+                SPDR = SPI_SLAVE_IDLE_BYTE;
+                SPI_SLAVE_State = SPI_SLAVE_WRITING;
+            } else {
+                SPDR = (SPI_SLAVE_Address < SPI_SLAVE_MAP_SIZE) ? SPI_SLAVE_Map[SPI_SLAVE_Address] : SPI_SLAVE_IDLE_BYTE;
+                ++SPI_SLAVE_Address;
+                SPI_SLAVE_State = SPI_SLAVE_READING;
+            }
+            break;
+
+        case SPI_SLAVE_READING:
+            SPDR = (address < SPI_SLAVE_MAP_SIZE) ? SPI_SLAVE_Map[address] : SPI_SLAVE_IDLE_BYTE;
+            SPI_SLAVE_Address = address + 1;
+            break;
+
+        case SPI_SLAVE_WRITING:
+        default:
+            SPDR = SPI_SLAVE_IDLE_BYTE;
+            head = (SPI_SLAVE_WriteHead + 1) & (SPI_SLAVE_WRITE_BUFFER_LENGTH - 1);
+
+            if(head == SPI_SLAVE_WriteTail) {
+                ++SPI_SLAVE_Overflows;
+            } else {
+                SPI_SLAVE_WriteAddresses[SPI_SLAVE_WriteHead] = address;
+                SPI_SLAVE_WriteValues[SPI_SLAVE_WriteHead] = received;
+                SPI_SLAVE_WriteHead = head;
+            }
+            SPI_SLAVE_Address = address + 1;
+            break;
+    }
+}
+
+/**************************************************************************
+ * @brief  SS rising edge: the next byte is the address of a new frame.
+ *************************************************************************/
+static void SPI_SLAVE_FrameEnd(void) {
+    const u8_t u8_tSreg = SREG;
+
+    /*!< The EXTI ISR may be nested: the STC ISR must not run in between */
+    GIE_Disable();
+    SPI_SLAVE_State = SPI_SLAVE_ADDRESS;
+    SPI_SLAVE_IsInFrame = 0;
+    SPDR = SPI_SLAVE_IDLE_BYTE;
+    SREG = u8_tSreg;
+
+    if(NULL != SPI_SLAVE_FrameCallback) {
+        SPI_SLAVE_FrameCallback();
+    }
+}
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * @file            SPI_SLAVE.h
+ * @author          Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief           Interfaces header file for \ref SPI_SLAVE.c
+ * @details         Protocol of a frame (SS LOW to SS HIGH), MSB first:
+ *                  - Read:  master sends the address (bit 7 = 0), then one
+ *                    dummy byte per register to read. The slave answers the
+ *                    registers from the address, auto incremented.
+ *                  - Write: master sends the address | SPI_SLAVE_WRITE, then
+ *                    the values of the registers from the address.
+ *                  The ISR prepares the next byte after each byte: the master
+ *                  must leave the ISR time between two bytes (roughly 100
+ *                  cycles, about 12 us at F_CPU = 8 MHz, estimated from the
+ *                  code). The bytes themselves can be clocked at F_CPU / 4.
+ * @version         1.0.0
+ * @date            2022-08-14
+ * PRECONDITIONS:   - SPI.c and EXTI.c must be included in the project
+ *                  - SPI_Config.mode is SPI_SLAVE (see SPI_cfg.c)
+ *                  - SS is wired to SPI_SLAVE_SS_EXTI (see SPI_SLAVE_cfg.h)
+ *                  - With BINDING_STATIC, SPI_SLAVE.c defines SPI_STC_Handler()
+ *                    (SPI) and the EXTIn_Handler() of SS (EXTI)
+ * @copyright       Copyright (c) 2022
+ ******************************************************************************/
+#ifndef SPI_SLAVE_H
+#define SPI_SLAVE_H
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+#define SPI_SLAVE_WRITE     (0x80U)     /*!< Flag of the address byte of a write */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                             API FUNCTIONS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief       Initialize the SPI module as a slave serving the register map.
+ * @param[in]   frameCallback: Called from the EXTI ISR at the end of each
+ *              frame (SS rising edge). Can be NULL.
+ * @return      ERROR_t: ERROR_INVALID_PARAMETER if SPI_Config.mode is not
+ *              SPI_SLAVE.
+ * @note        The global interrupt is enabled by this function.
+ ******************************************************************************/
+ERROR_t SPI_SLAVE_Init(void (* const frameCallback)(void));
+
+/*******************************************************************************
+ * @brief       Update registers of the map read by the master.
+ * @param[in]   address: First register.
+ * @param[in]   data: New values.
+ * @param[in]   length: Number of registers.
+ * @return      ERROR_t:
+ *              - ERROR_BUSY: A frame is in progress (SS is LOW). Retry after
+ *                the frame callback, so the master never reads a value
+ *                written half way.
+ *              - ERROR_OUT_OF_RANGE: The registers are out of the map.
+ ******************************************************************************/
+ERROR_t SPI_SLAVE_SetRegisters(const u8_t address, const u8_t * const data, const u8_t length);
+
+/*******************************************************************************
+ * @brief       Get the oldest register written by the master. The writes do
+ *              not change the map: the application applies them.
+ * @param[out]  ptrToAddress: The register.
+ * @param[out]  ptrToValue: The written value.
+ * @return      ERROR_t: ERROR_NOK if no write is waiting.
+ ******************************************************************************/
+ERROR_t SPI_SLAVE_GetWrite(u8_t * const ptrToAddress, u8_t * const ptrToValue);
+
+/*******************************************************************************
+ * @brief       Number of writes of the master dropped because the buffer of
+ *              SPI_SLAVE_GetWrite() was full.
+ ******************************************************************************/
+ERROR_t SPI_SLAVE_GetOverflows(u16_t * const ptrToOverflows);
+
+#endif      /* SPI_SLAVE_H */
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * @file        SPI_SLAVE_cfg.h
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Configuration header file for \ref SPI_SLAVE.c
+ * @version     1.0.0
+ * @date        2022-08-14
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#ifndef SPI_SLAVE_CFG_H
+#define SPI_SLAVE_CFG_H
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Number of registers of the map read by the master (1 to 128).
+ ******************************************************************************/
+#define SPI_SLAVE_MAP_SIZE              (32U)
+
+/******************************************************************************
+ * @brief   Number of bytes written by the master that can wait for
+ *          SPI_SLAVE_GetWrite() (power of 2, 2 to 128).
+ ******************************************************************************/
+#define SPI_SLAVE_WRITE_BUFFER_LENGTH   (16U)
+
+/******************************************************************************
+ * @brief   Number of the external interrupt wired to SS (PB0 has no external
+ *          interrupt), a plain digit from 0 to 7. Its rising edge ends a
+ *          frame. Example: PB0 connected to PE4 (INT4).
+ ******************************************************************************/
+#define SPI_SLAVE_SS_EXTI_NUMBER        4
+
+/******************************************************************************
+ * @brief   Byte sent by the slave when it has nothing to send: during the
+ *          address byte and the writes, or after the end of the map.
+ ******************************************************************************/
+#define SPI_SLAVE_IDLE_BYTE             (0x00U)
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#if (SPI_SLAVE_MAP_SIZE < 1) || (SPI_SLAVE_MAP_SIZE > 128)
+#error "SPI_SLAVE_MAP_SIZE is out of range"
+#endif
+
+#if (SPI_SLAVE_SS_EXTI_NUMBER < 0) || (SPI_SLAVE_SS_EXTI_NUMBER > 7)
+#error "SPI_SLAVE_SS_EXTI_NUMBER is out of range"
+#endif
+
+#if (SPI_SLAVE_WRITE_BUFFER_LENGTH < 2) || (SPI_SLAVE_WRITE_BUFFER_LENGTH > 128) || \
+    (SPI_SLAVE_WRITE_BUFFER_LENGTH & (SPI_SLAVE_WRITE_BUFFER_LENGTH - 1))
+#error "SPI_SLAVE_WRITE_BUFFER_LENGTH must be a power of 2 from 2 to 128"
+#endif
+
+/*!< EXTI_n and EXTIn_Handler() of SPI_SLAVE_SS_EXTI_NUMBER */
+#define SPI_SLAVE_PASTE(A, N, B)        A##N##B
+#define SPI_SLAVE_EXPAND(A, N, B)       SPI_SLAVE_PASTE(A, N, B)
+#define SPI_SLAVE_SS_EXTI               SPI_SLAVE_EXPAND(EXTI_, SPI_SLAVE_SS_EXTI_NUMBER, )
+#define SPI_SLAVE_SS_HANDLER            SPI_SLAVE_EXPAND(EXTI, SPI_SLAVE_SS_EXTI_NUMBER, _Handler)
+
+#endif    /* SPI_SLAVE_CFG_H */
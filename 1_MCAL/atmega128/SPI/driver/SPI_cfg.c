@@ -21,10 +21,10 @@
 
 SPI_CONFIG_t SPI_Config = {
     .connections = { 
-        .SS     = { .pin = DIO_PIN_0, .port = DIO_PORT_B},
-        .SCK    = { .pin = DIO_PIN_1, .port = DIO_PORT_B},
-        .MOSI   = { .pin = DIO_PIN_2, .port = DIO_PORT_B},
-        .MISO   = { .pin = DIO_PIN_3, .port = DIO_PORT_B}
+        .SS     = DIO_PINS_SPI_SS,
+        .SCK    = DIO_PINS_SPI_SCK,
+        .MOSI   = DIO_PINS_SPI_MOSI,
+        .MISO   = DIO_PINS_SPI_MISO
     },
     .mode           = SPI_MASTER,
     .clockDivider   = SPI_PRESCALER_8,
@@ -9,12 +9,43 @@
 #ifndef SPI_CFG_H   
 #define SPI_CFG_H   
 
+#include "BINDING.h"
+
 /*----------------------------------------------------------------------------*/
 /*                                                                            */
-/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
 /*                                                                            */
 /*----------------------------------------------------------------------------*/
 
+/******************************************************************************
+ * @brief Binding of the serial transfer complete ISR to the application
+ *        (see BINDING.h).
+ *        Options are:
+ *          BINDING_RUNTIME --> the callbacks passed to the SPI APIs
+ *          BINDING_STATIC  --> SPI_STC_Handler() (see SPI.h)
+ *****************************************************************************/
+#define SPI_HANDLERS_BINDING      BINDING_RUNTIME
+
+/******************************************************************************
+ * @brief Byte sent by SPI_Transfer() when it has no buffer to send.
+ *****************************************************************************/
+#define SPI_DUMMY_BYTE            (0xFFU)
+
+/******************************************************************************
+ * @brief Clock of SPI_Burst() in master mode. Options are:
+ *          1 --> F_CPU / 2 (SPI2X and SPR1:0 = 0), the fastest clock. All the
+ *                devices on the bus must support it.
+ *          0 --> the clock set by SPI_Init() or SPI_BUS_Select(). Use it with
+ *                SPI_BUS: the clock of each device is set in SPI_BUS_cfg.c.
+ *****************************************************************************/
+#define SPI_BURST_MAX_SPEED       (0)
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
 
 typedef enum{
     SPI_MASTER,
@@ -49,15 +80,10 @@ typedef enum{
 }SPI_DOUBLE_SPEED_t;
 
 typedef struct{
-    DIO_PIN_t   pin;
-    DIO_PORT_t  port;
-}SPI_PINS_t;
-
-typedef struct{
-    SPI_PINS_t  SS;
-    SPI_PINS_t  MOSI;
-    SPI_PINS_t  MISO;
-    SPI_PINS_t  SCK;
+    DIO_PINS_t  SS;
+    DIO_PINS_t  MOSI;
+    DIO_PINS_t  MISO;
+    DIO_PINS_t  SCK;
 }SPI_CONNECTIONS_t;
 
 typedef struct{
@@ -18,6 +18,7 @@
 #define SPCR        (* ((volatile u8_t *) 0x2D) )
 #define SPSR        (* ((volatile u8_t *) 0x2E) )
 #define SPDR        (* ((volatile u8_t *) 0x2F) )
+#define SREG        (* ((volatile u8_t *) 0x5F) )
 
 
 enum {
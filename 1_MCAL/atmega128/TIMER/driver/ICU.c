@@ -0,0 +1,531 @@
+/******************************************************************************
+ * @file        ICU.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Input Capture Unit (ICU) measurement engine for ATmega128
+ *              microcontroller, built on ICP1 (TIMER1) and ICP3 (TIMER3).
+ * @details     The timer of each unit runs freely in normal mode. Its overflow
+ *              interrupt counts the upper 16 bits of a 32 bits time base, and
+ *              the capture interrupt:
+ *              1. Extends the captured value (ICRn) to 32 bits.
+ *              2. Pushes the timestamp into the ring buffer of the channel.
+ *              3. Updates the period (rising to rising) and the high time
+ *                 (rising to falling).
+ *              4. Toggles the capture edge if the high time is measured.
+ *              So, tach and flow-meter signals are measured without polling.
+ * @note        If an overflow and a capture happen at the same time, the
+ *              capture ISR runs first (higher priority). A pending overflow
+ *              flag with a small captured value means that the overflow
+ *              happened before the capture, so it is counted for this capture.
+ * @version     1.0.0
+ * @date        2022-07-10
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "TIMER_reg.h"
+#include "SREG.h"
+#include "GIE.h"
+#include "TIMER.h"
+#include "TIMER_cfg.h"
+#include "ICU.h"
+#include "ICU_cfg.h"
+
+#if (TIMER_HANDLERS_BINDING == BINDING_STATIC)
+#error "ICU: the timer callbacks are ignored with BINDING_STATIC, set TIMER_HANDLERS_BINDING to BINDING_RUNTIME"
+#endif
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE TYPES                                  */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+typedef struct {
+    ICU_TIMESTAMP_t         ring[ICU_RING_SIZE];    /*!< Captured edges */
+    volatile u8_t           head;                   /*!< Written by the ISR only */
+    volatile u8_t           tail;                   /*!< Written by the application only */
+    volatile u8_t           overruns;               /*!< Edges dropped because the ring was full */
+    volatile u8_t           risingEdges;            /*!< Rising edges captured, saturates at 2 */
+    volatile u8_t           highTimeValid;          /*!< A falling edge followed a rising edge */
+    volatile u16_t          overflows;              /*!< Upper 16 bits of the time base */
+    volatile u16_t          lastEdgeOverflows;      /*!< overflows at the last captured edge */
+    u32_t                   lastRising;             /*!< Timestamp of the last rising edge */
+    volatile u32_t          period;                 /*!< Last period in ticks */
+    volatile u32_t          highTime;               /*!< Last high time in ticks */
+    TIMER_CAPTURE_EDGE_t    nextEdge;               /*!< Edge that ICESn is waiting for */
+} ICU_STATE_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                          PRIVATE FUNCTIONS PROTOTYPES                       */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+static ERROR_t ICU_GetChannelIndex(const ICU_CHANNEL_t channel, s8_t * const index);
+static ERROR_t ICU_GetSignal(const s8_t index, u32_t * const ptrToPeriod, u32_t * const ptrToHighTime);
+static u32_t ICU_GetPrescaler(const TIMER_CLOCK_t clock);
+static void ICU_ResetState(ICU_STATE_t * const state);
+static void ICU_Capture(const ICU_UNIT_t unit, const u16_t captured, const u8_t overflowPending);
+static void ICU_Unit1Capture(void);
+static void ICU_Unit1Overflow(void);
+static void ICU_Unit3Capture(void);
+static void ICU_Unit3Overflow(void);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE VARIABLES                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+static ICU_STATE_t ICU_States[NUM_OF_ICU_UNITS];
+static s8_t ICU_UnitToIndex[NUM_OF_ICU_UNITS] = {-1, -1};   /*!< Index in icuConfigs of each unit */
+static const TIMER_t ICU_Timers[NUM_OF_ICU_UNITS] = {TIMER_1, TIMER_3};
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              MACRO LIKE FUNCTIONS                           */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+#define ASSERT_VALID_UNIT(unit)     ((unit) < NUM_OF_ICU_UNITS )
+#define ICU_TIMER_RESOURCES         (TIMER_RES_COUNTER | TIMER_RES_OVERFLOW | TIMER_RES_CAPTURE)
+#define RING_NEXT(index)            ( ((index) + 1) & (ICU_RING_SIZE - 1) )
+
+#if (ICU_RING_SIZE & (ICU_RING_SIZE - 1)) || (ICU_RING_SIZE > 128)
+#error "ICU_RING_SIZE must be a power of 2 and less than 256"
+#endif
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUBLIC FUNCTIONS                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+ERROR_t ICU_Init(void) {
+    ERROR_t error = ERROR_OK;
+    ERROR_t reserved = ERROR_OK;
+    ICU_UNIT_t unit = ICU_UNIT_1;
+    u8_t i = 0;
+
+    for(i = 0; i < countIcuChannelsConfigured; ++i) {
+        unit = icuConfigs[i].unit;
+
+        if( !ASSERT_VALID_UNIT(unit) ) {
+            error |= ERROR_INVALID_PARAMETER;
+            continue;
+        }
+
+        if(ICU_UnitToIndex[unit] >= 0) {
+            error |= ERROR_BUSY;            /*!< The unit is used by another channel */
+            continue;
+        }
+
+        /*!< The timer of the unit runs freely: it can not be shared with PWM */
+        reserved = TIMER_Reserve(ICU_Timers[unit], ICU_TIMER_RESOURCES, TIMER_USER_ICU, 
+                                 icuConfigs[i].clock, TIMER_MODE_NORMAL);
+        if(ERROR_OK != reserved) {
+            error |= reserved;
+            continue;
+        }
+
+        ICU_UnitToIndex[unit] = (s8_t)i;
+        ICU_ResetState(&ICU_States[unit]);
+
+        switch(unit) {
+            case ICU_UNIT_1:
+                /*!< Keep the counter value: TIMER1 may be running for other users (SOFT_PWM) */
+                TIMER1_Init(TIMER1_GetTimerValue(), icuConfigs[i].clock, TIMER_MODE_NORMAL, NO_OC, TIMER_OCA);
+                TIMER1_ConfigCapture(TIMER_CAPTURE_RISING_EDGE, icuConfigs[i].noiseCanceler);
+                TIMER1_EnableOverflowInterrupt(ICU_Unit1Overflow);
+                TIMER1_EnableCaptureInterrupt(ICU_Unit1Capture);
+                break;
+            case ICU_UNIT_3:
+                TIMER3_Init(TIMER3_GetTimerValue(), icuConfigs[i].clock, TIMER_MODE_NORMAL, NO_OC, TIMER_OCA);
+                TIMER3_ConfigCapture(TIMER_CAPTURE_RISING_EDGE, icuConfigs[i].noiseCanceler);
+                TIMER3_EnableOverflowInterrupt(ICU_Unit3Overflow);
+                TIMER3_EnableCaptureInterrupt(ICU_Unit3Capture);
+                break;
+            default:
+                break;
+        }
+    }
+
+    GIE_Enable();
+
+    return error;
+}
+
+ERROR_t ICU_Disable(const ICU_CHANNEL_t channel) {
+    ERROR_t error = ERROR_OK;
+    u8_t isCounterFree = 0;
+    s8_t i = -1;
+
+    error |= ICU_GetChannelIndex(channel, &i);
+
+    if( (ERROR_OK == error) && (i >= 0) ) {
+        ICU_UnitToIndex[icuConfigs[i].unit] = -1;
+        error |= TIMER_Release(ICU_Timers[icuConfigs[i].unit], ICU_TIMER_RESOURCES, TIMER_USER_ICU);
+
+        /*!< The counter keeps running while other users share it */
+        isCounterFree = (0 == TIMER_GetCounterUsers(ICU_Timers[icuConfigs[i].unit]));
+
+        switch(icuConfigs[i].unit) {
+            case ICU_UNIT_1:
+                TIMER1_DisableCaptureInterrupt();
+                TIMER1_DisableOverflowInterrupt();
+                if(isCounterFree) {
+                    TIMER1_Init(0, NO_CLOCK, TIMER_MODE_NORMAL, NO_OC, TIMER_OCA);
+                }
+                break;
+            case ICU_UNIT_3:
+                TIMER3_DisableCaptureInterrupt();
+                TIMER3_DisableOverflowInterrupt();
+                if(isCounterFree) {
+                    TIMER3_Init(0, NO_CLOCK, TIMER_MODE_NORMAL, NO_OC, TIMER_OCA);
+                }
+                break;
+            default:
+                break;
+        }
+    } else {
+        error |= ERROR_INVALID_PARAMETER;
+    }
+
+    return error;
+}
+
+ERROR_t ICU_GetPeriod(const ICU_CHANNEL_t channel, u32_t * const ptrToTicks) {
+    ERROR_t error = ERROR_OK;
+    u32_t highTime = 0;
+    s8_t i = -1;
+
+    if(NULL == ptrToTicks) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ICU_GetChannelIndex(channel, &i);
+
+    if( (ERROR_OK == error) && (i >= 0) ) {
+        error |= ICU_GetSignal(i, ptrToTicks, &highTime);
+    } else {
+        error |= ERROR_INVALID_PARAMETER;
+    }
+
+    return error;
+}
+
+ERROR_t ICU_GetHighTime(const ICU_CHANNEL_t channel, u32_t * const ptrToTicks) {
+    ERROR_t error = ERROR_OK;
+    u32_t period = 0;
+    s8_t i = -1;
+
+    if(NULL == ptrToTicks) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ICU_GetChannelIndex(channel, &i);
+
+    if( (ERROR_OK == error) && (i >= 0) && (ICU_MEASURE_PERIOD_AND_HIGH == icuConfigs[i].measure) ) {
+        error |= ICU_GetSignal(i, &period, ptrToTicks);
+    } else {
+        error |= ERROR_INVALID_PARAMETER;
+    }
+
+    return error;
+}
+
+ERROR_t ICU_GetFrequency(const ICU_CHANNEL_t channel, u32_t * const ptrToFrequency) {
+    ERROR_t error = ERROR_OK;
+    u32_t tickFrequency = 0;
+    u32_t period = 0;
+
+    if(NULL == ptrToFrequency) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ICU_GetTickFrequency(channel, &tickFrequency);
+    error |= ICU_GetPeriod(channel, &period);
+
+    if( (ERROR_OK == error) && (period > 0) ) {
+        *ptrToFrequency = (tickFrequency + (period / 2)) / period;
+    } else {
+        *ptrToFrequency = 0;
+    }
+
+    return error;
+}
+
+ERROR_t ICU_GetDutyCycle(const ICU_CHANNEL_t channel, u8_t * const ptrToDutyCycle) {
+    ERROR_t error = ERROR_OK;
+    u32_t highTime = 0;
+    u32_t period = 0;
+    s8_t i = -1;
+
+    if(NULL == ptrToDutyCycle) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ICU_GetChannelIndex(channel, &i);
+
+    if( (ERROR_OK == error) && (i >= 0) && (ICU_MEASURE_PERIOD_AND_HIGH == icuConfigs[i].measure) ) {
+        error |= ICU_GetSignal(i, &period, &highTime);
+    } else {
+        error |= ERROR_INVALID_PARAMETER;
+    }
+
+    if( (ERROR_OK == error) && (period > 0) ) {
+        /*!< Scale down long periods first, so that highTime * 100 fits in 32 bits */
+        while(period > 0x00FFFFFFUL) {
+            period   >>= 1;
+            highTime >>= 1;
+        }
+        *ptrToDutyCycle = (u8_t)( (highTime * 100UL) / period );
+    } else {
+        *ptrToDutyCycle = 0;
+    }
+
+    return error;
+}
+
+ERROR_t ICU_GetTickFrequency(const ICU_CHANNEL_t channel, u32_t * const ptrToFrequency) {
+    ERROR_t error = ERROR_OK;
+    u32_t prescaler = 0;
+    s8_t i = -1;
+
+    if(NULL == ptrToFrequency) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ICU_GetChannelIndex(channel, &i);
+
+    if( (ERROR_OK == error) && (i >= 0) ) {
+        prescaler = ICU_GetPrescaler(icuConfigs[i].clock);
+    }
+
+    if(prescaler > 0) {
+        *ptrToFrequency = (u32_t)(F_CPU / prescaler);
+    } else {
+        error |= ERROR_INVALID_PARAMETER;
+    }
+
+    return error;
+}
+
+ERROR_t ICU_ReadTimestamp(const ICU_CHANNEL_t channel, ICU_TIMESTAMP_t * const ptrToTimestamp) {
+    ERROR_t error = ERROR_OK;
+    ICU_STATE_t * state = NULL;
+    s8_t i = -1;
+
+    if(NULL == ptrToTimestamp) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ICU_GetChannelIndex(channel, &i);
+
+    if( (ERROR_OK == error) && (i >= 0) ) {
+        state = &ICU_States[icuConfigs[i].unit];
+
+        if(state->tail != state->head) {
+            /*!< The ISR never writes the slot at tail, so no need to disable interrupts */
+            *ptrToTimestamp = state->ring[state->tail];
+            state->tail = RING_NEXT(state->tail);
+        } else {
+            error |= ERROR_NOK;
+        }
+    } else {
+        error |= ERROR_INVALID_PARAMETER;
+    }
+
+    return error;
+}
+
+ERROR_t ICU_GetOverruns(const ICU_CHANNEL_t channel, u8_t * const ptrToOverruns) {
+    ERROR_t error = ERROR_OK;
+    s8_t i = -1;
+
+    if(NULL == ptrToOverruns) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ICU_GetChannelIndex(channel, &i);
+
+    if( (ERROR_OK == error) && (i >= 0) ) {
+        *ptrToOverruns = ICU_States[icuConfigs[i].unit].overruns;
+    } else {
+        error |= ERROR_INVALID_PARAMETER;
+    }
+
+    return error;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE FUNCTIONS                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+static ERROR_t ICU_GetChannelIndex(const ICU_CHANNEL_t channel, s8_t * const index) {
+    u8_t i = 0;
+
+    if(NULL == index) {
+        return ERROR_NULL_POINTER;
+    } else {
+        *index = -1;
+    }
+
+    for(i = 0; i < countIcuChannelsConfigured; ++i) {
+        if(icuConfigs[i].channel == channel) {
+            *index = i;
+            break;
+        }
+    }
+
+    return ERROR_OK;
+}
+
+/******************************************************************************
+ * @brief Take a consistent snapshot of the measurements of a channel.
+ *****************************************************************************/
+static ERROR_t ICU_GetSignal(const s8_t index, u32_t * const ptrToPeriod, u32_t * const ptrToHighTime) {
+    ERROR_t error = ERROR_OK;
+    const ICU_STATE_t * const state = &ICU_States[icuConfigs[index].unit];
+    u16_t silentOverflows = 0;
+    u8_t risingEdges = 0;
+    u8_t highTimeValid = 0;
+    const u8_t u8_tSreg = SREG;
+
+    GIE_Disable();
+
+    *ptrToPeriod    = state->period;
+    *ptrToHighTime  = state->highTime;
+    risingEdges     = state->risingEdges;
+    highTimeValid   = state->highTimeValid;
+    silentOverflows = (u16_t)(state->overflows - state->lastEdgeOverflows);
+
+    SREG = u8_tSreg;
+
+    if(silentOverflows > ICU_SIGNAL_TIMEOUT_OVERFLOWS) {
+        error |= ERROR_TIMEOUT;
+    } else if( (risingEdges < 2) ||
+               ( (ICU_MEASURE_PERIOD_AND_HIGH == icuConfigs[index].measure) && (!highTimeValid) ) ) {
+        error |= ERROR_BUSY;
+    } else {
+        /* Signal is valid */
+    }
+
+    return error;
+}
+
+static u32_t ICU_GetPrescaler(const TIMER_CLOCK_t clock) {
+    u32_t prescaler = 0;
+
+    switch(clock) {
+        case F_CPU_CLOCK:   prescaler = 1;      break;
+        case F_CPU_8:       prescaler = 8;      break;
+        case F_CPU_64:      prescaler = 64;     break;
+        case F_CPU_256:     prescaler = 256;    break;
+        case F_CPU_1024:    prescaler = 1024;   break;
+        default:
+            /*!< External clock or not available for 16-bit timers */
+            prescaler = 0;
+            break;
+    }
+
+    return prescaler;
+}
+
+static void ICU_ResetState(ICU_STATE_t * const state) {
+    state->head                 = 0;
+    state->tail                 = 0;
+    state->overruns             = 0;
+    state->risingEdges          = 0;
+    state->highTimeValid        = 0;
+    state->overflows            = 0;
+    state->lastEdgeOverflows    = 0;
+    state->lastRising           = 0;
+    state->period               = 0;
+    state->highTime             = 0;
+    state->nextEdge             = TIMER_CAPTURE_RISING_EDGE;
+}
+
+/******************************************************************************
+ * @brief Common capture handler of both units, called from the capture ISRs.
+ * @param[in] unit: The unit that captured the edge.
+ * @param[in] captured: The captured value (ICRn).
+ * @param[in] overflowPending: TOVn flag at the time of the capture.
+ *****************************************************************************/
+static void ICU_Capture(const ICU_UNIT_t unit, const u16_t captured, const u8_t overflowPending) {
+    ICU_STATE_t * const state = &ICU_States[unit];
+    const s8_t index = ICU_UnitToIndex[unit];
+    const TIMER_CAPTURE_EDGE_t edge = state->nextEdge;
+    u16_t overflows = state->overflows;
+    u32_t ticks = 0;
+    u8_t next = 0;
+
+    if(index < 0) {
+        return;
+    }
+
+    /*!< The overflow happened before the capture but its ISR did not run yet */
+    if( overflowPending && (captured < 0x8000U) ) {
+        ++overflows;
+    }
+
+    ticks = ((u32_t)overflows << 16) | captured;
+    state->lastEdgeOverflows = overflows;
+
+    /*!< Push the timestamp, drop it if the ring is full */
+    next = RING_NEXT(state->head);
+    if(next != state->tail) {
+        state->ring[state->head].ticks = ticks;
+        state->ring[state->head].edge  = edge;
+        state->head = next;
+    } else if(state->overruns < 255) {
+        ++state->overruns;
+    } else {
+        /* Saturated */
+    }
+
+    if(TIMER_CAPTURE_RISING_EDGE == edge) {
+        if(state->risingEdges > 0) {
+            state->period = ticks - state->lastRising;
+        }
+        if(state->risingEdges < 2) {
+            ++state->risingEdges;
+        }
+        state->lastRising = ticks;
+    } else if(state->risingEdges > 0) {
+        state->highTime = ticks - state->lastRising;
+        state->highTimeValid = 1;
+    } else {
+        /* Falling edge before the first rising edge: ignore it */
+    }
+
+    if(ICU_MEASURE_PERIOD_AND_HIGH == icuConfigs[index].measure) {
+        state->nextEdge = (TIMER_CAPTURE_RISING_EDGE == edge) ? TIMER_CAPTURE_FALLING_EDGE :
+                                                                TIMER_CAPTURE_RISING_EDGE;
+        if(ICU_UNIT_1 == unit) {
+            TIMER1_SetCaptureEdge(state->nextEdge);
+        } else {
+            TIMER3_SetCaptureEdge(state->nextEdge);
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                          CALLBACKS OF TIMER ISRs                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+static void ICU_Unit1Capture(void) {
+    ICU_Capture(ICU_UNIT_1, TIMER1_GetCaptureValue(), BIT_IS_SET(TIMER_u8_tTIFR_REG, TOV1) ? 1 : 0);
+}
+
+static void ICU_Unit1Overflow(void) {
+    ++ICU_States[ICU_UNIT_1].overflows;
+}
+
+static void ICU_Unit3Capture(void) {
+    ICU_Capture(ICU_UNIT_3, TIMER3_GetCaptureValue(), BIT_IS_SET(TIMER_u8_tETIFR_REG, TOV3) ? 1 : 0);
+}
+
+static void ICU_Unit3Overflow(void) {
+    ++ICU_States[ICU_UNIT_3].overflows;
+}
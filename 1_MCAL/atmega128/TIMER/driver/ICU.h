@@ -0,0 +1,121 @@
+/******************************************************************************
+ * @file            ICU.h
+ * @author          Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief           Interface file for the Input Capture Unit (ICU) measurement
+ *                  engine (\ref ICU.c)
+ * @version         1.0.0
+ * @date            2022-07-10
+ * PRECONDITIONS:   - TIMER.c must be included in the project
+ *                  - TIMER.h must be included before ICU.h
+ * @copyright       Copyright (c) 2022
+ ******************************************************************************/
+#ifndef ICU_H
+#define ICU_H
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+typedef enum {
+    ICU_CHANNEL_TACHO,
+    ICU_CHANNEL_FLOW,
+} ICU_CHANNEL_t;
+
+/******************************************************************************
+ * @brief   A captured edge.
+ * @note    ticks is extended to 32 bits by counting the timer overflows, so it
+ *          wraps around after 2^32 ticks. Differences between two timestamps
+ *          are always valid using unsigned subtraction.
+ *****************************************************************************/
+typedef struct {
+    u32_t                   ticks;      /*!< Time of the edge in timer ticks */
+    TIMER_CAPTURE_EDGE_t    edge;       /*!< Captured edge: rising or falling */
+} ICU_TIMESTAMP_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                             API FUNCTIONS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief       Initialize the capture channels configured in ICU_cfg.c and
+ *              start capturing.
+ * @return      ERROR_t: ERROR_BUSY if two channels use the same unit, or the
+ *              timer of a unit is reserved by another module (\ref TIMER_Reserve).
+ * @note        Global interrupts are enabled by this function.
+ ******************************************************************************/
+ERROR_t ICU_Init(void);
+
+/*******************************************************************************
+ * @brief       Stop capturing on a channel. Its timer is stopped if no other
+ *              module shares the counter (\ref TIMER_GetCounterUsers).
+ * @param[in]   channel: The channel to stop. See \ref ICU_CHANNEL_t.
+ ******************************************************************************/
+ERROR_t ICU_Disable(const ICU_CHANNEL_t channel);
+
+/*******************************************************************************
+ * @brief       Get the period of the signal (rising edge to rising edge)
+ * @param[in]   channel: See \ref ICU_CHANNEL_t.
+ * @param[out]  ptrToTicks: The period in timer ticks.
+ * @return      ERROR_t: - ERROR_BUSY if two rising edges were not captured yet.
+ *                       - ERROR_TIMEOUT if the signal stopped
+ *                         (see ICU_SIGNAL_TIMEOUT_OVERFLOWS).
+ ******************************************************************************/
+ERROR_t ICU_GetPeriod(const ICU_CHANNEL_t channel, u32_t * const ptrToTicks);
+
+/*******************************************************************************
+ * @brief       Get the high time of the signal (rising edge to falling edge)
+ * @param[in]   channel: See \ref ICU_CHANNEL_t.
+ * @param[out]  ptrToTicks: The high time in timer ticks.
+ * @return      ERROR_t: ERROR_INVALID_PARAMETER if the channel is not
+ *              configured as ICU_MEASURE_PERIOD_AND_HIGH, otherwise the same
+ *              as \ref ICU_GetPeriod.
+ ******************************************************************************/
+ERROR_t ICU_GetHighTime(const ICU_CHANNEL_t channel, u32_t * const ptrToTicks);
+
+/*******************************************************************************
+ * @brief       Get the frequency of the signal
+ * @param[in]   channel: See \ref ICU_CHANNEL_t.
+ * @param[out]  ptrToFrequency: The frequency in Hz (rounded).
+ * @return      ERROR_t: The same as \ref ICU_GetPeriod.
+ ******************************************************************************/
+ERROR_t ICU_GetFrequency(const ICU_CHANNEL_t channel, u32_t * const ptrToFrequency);
+
+/*******************************************************************************
+ * @brief       Get the duty cycle of the signal
+ * @param[in]   channel: See \ref ICU_CHANNEL_t.
+ * @param[out]  ptrToDutyCycle: The duty cycle in % (0 - 100).
+ * @return      ERROR_t: The same as \ref ICU_GetHighTime.
+ ******************************************************************************/
+ERROR_t ICU_GetDutyCycle(const ICU_CHANNEL_t channel, u8_t * const ptrToDutyCycle);
+
+/*******************************************************************************
+ * @brief       Get the frequency of the timer of a channel, to convert ticks
+ *              into time: time in us = ticks * 1000000 / tick frequency.
+ * @param[in]   channel: See \ref ICU_CHANNEL_t.
+ * @param[out]  ptrToFrequency: The tick frequency in Hz (F_CPU / prescaler).
+ ******************************************************************************/
+ERROR_t ICU_GetTickFrequency(const ICU_CHANNEL_t channel, u32_t * const ptrToFrequency);
+
+/*******************************************************************************
+ * @brief       Pop the oldest captured edge from the ring buffer of a channel.
+ * @param[in]   channel: See \ref ICU_CHANNEL_t.
+ * @param[out]  ptrToTimestamp: The oldest captured edge.
+ * @return      ERROR_t: ERROR_NOK if the ring buffer is empty.
+ * @note        When the ring buffer is full, new edges are dropped (the
+ *              period and high time are still updated) and counted in
+ *              \ref ICU_GetOverruns.
+ ******************************************************************************/
+ERROR_t ICU_ReadTimestamp(const ICU_CHANNEL_t channel, ICU_TIMESTAMP_t * const ptrToTimestamp);
+
+/*******************************************************************************
+ * @brief       Get the number of edges dropped because the ring buffer was full
+ * @param[in]   channel: See \ref ICU_CHANNEL_t.
+ * @param[out]  ptrToOverruns: Number of dropped edges (saturates at 255).
+ ******************************************************************************/
+ERROR_t ICU_GetOverruns(const ICU_CHANNEL_t channel, u8_t * const ptrToOverruns);
+
+#endif      /* ICU_H */
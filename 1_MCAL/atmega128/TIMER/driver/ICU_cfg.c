@@ -0,0 +1,43 @@
+/******************************************************************************
+ * @file        ICU_cfg.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Configuration source file for \ref ICU.c
+ * @version     1.0.0
+ * @date        2022-07-10
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#include "STD_TYPES.h"
+#include "TIMER.h"
+#include "ICU.h"
+#include "ICU_cfg.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Configuration of the input capture channels.
+ * @details Each unit (ICU_UNIT_1, ICU_UNIT_3) can be used by one channel only,
+ *          and its timer is owned by the ICU module (normal mode, overflow and
+ *          capture interrupts).
+ ******************************************************************************/
+const ICU_CONFIGS_t  icuConfigs[] = {
+    {ICU_CHANNEL_TACHO, ICU_UNIT_1, F_CPU_8,  ICU_MEASURE_PERIOD_AND_HIGH, TIMER_NOISE_CANCELER_ON},
+    {ICU_CHANNEL_FLOW,  ICU_UNIT_3, F_CPU_64, ICU_MEASURE_PERIOD,          TIMER_NOISE_CANCELER_ON},
+};
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Number of used capture channels.
+ * @details This variable counts the number of used capture channels which is
+ *          equal to the number of elements in the \ref icuConfigs array.
+ ******************************************************************************/
+const u8_t countIcuChannelsConfigured = sizeof(icuConfigs) / sizeof(icuConfigs[0]);
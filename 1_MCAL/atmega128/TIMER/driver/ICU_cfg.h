@@ -0,0 +1,71 @@
+/******************************************************************************
+ * @file        ICU_cfg.h
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Configuration header file for \ref ICU.c
+ * @version     1.0.0
+ * @date        2022-07-10
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#ifndef ICU_CFG_H
+#define ICU_CFG_H
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Number of timestamps buffered per channel.
+ * @warning Must be a power of 2 (2, 4, 8, 16, ...) and less than 256.
+ ******************************************************************************/
+#define ICU_RING_SIZE                   (8U)
+
+/******************************************************************************
+ * @brief   Number of timer overflows without any captured edge after which the
+ *          signal is considered lost (stopped fan, no flow, ...).
+ *          With F_CPU = 8 MHz and F_CPU_8 one overflow is 65.536 ms.
+ ******************************************************************************/
+#define ICU_SIGNAL_TIMEOUT_OVERFLOWS    (4U)
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+typedef enum {
+    ICU_UNIT_1,             /*!< Input capture unit of TIMER1: ICP1 pin (PD4) */
+    ICU_UNIT_3,             /*!< Input capture unit of TIMER3: ICP3 pin (PE7) */
+    NUM_OF_ICU_UNITS
+} ICU_UNIT_t;
+
+typedef enum {
+    ICU_MEASURE_PERIOD,             /*!< Capture rising edges only: period and frequency */
+    ICU_MEASURE_PERIOD_AND_HIGH,    /*!< Toggle the edge after every capture: period, frequency and high time */
+} ICU_MEASURE_t;
+
+/******************************************************************************
+ * @brief   This struct is used to pass the configuration of a capture channel
+ *          to the APIs of the ICU module.
+ * @note    Members:
+ *          - ICU_CHANNEL_t channel: The name of the channel.
+ *          - ICU_UNIT_t unit: The input capture unit (timer) of the channel.
+ *          - TIMER_CLOCK_t clock: The prescaler of the timer. It sets the
+ *            resolution of the measurements: tick = prescaler / F_CPU.
+ *          - ICU_MEASURE_t measure: What is measured from the signal.
+ *          - TIMER_NOISE_CANCELER_t noiseCanceler: The noise canceler of ICPn.
+ *****************************************************************************/
+typedef struct {
+    ICU_CHANNEL_t           channel;
+    ICU_UNIT_t              unit;
+    TIMER_CLOCK_t           clock;
+    ICU_MEASURE_t           measure;
+    TIMER_NOISE_CANCELER_t  noiseCanceler;
+} ICU_CONFIGS_t;
+
+extern const ICU_CONFIGS_t  icuConfigs[];
+extern const u8_t countIcuChannelsConfigured;
+
+#endif    /* ICU_CFG_H */
@@ -12,6 +12,7 @@
 #include "SREG.h"
 #include "GIE.h"
 #include "TIMER.h"
+#include "TIMER_cfg.h"
 
 
 /*------------------------------------------------------------------------------*/
@@ -38,6 +39,52 @@ static void (*TIMER3_COMPB_CBK_PTR)(void);
 static void (*TIMER3_COMPC_CBK_PTR)(void);
 static void (*TIMER3_CAPT_CBK_PTR)(void) ;
 
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          TIMERS ALLOCATION                                   */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+typedef struct {
+    u16_t           counterUsers;   /*!< One bit per TIMER_USER_t sharing the counter */
+    TIMER_CLOCK_t   clock;          /*!< Clock of the counter, valid if counterUsers != 0 */
+    TIMER_MODE_t    mode;           /*!< Mode of the counter, valid if counterUsers != 0 */
+    TIMER_USER_t    owners[8];      /*!< Owner of each exclusive resource, indexed by bit number */
+} TIMER_ALLOCATION_t;
+
+static TIMER_ALLOCATION_t TIMER_Allocations[NUM_OF_TIMERS];
+
+/*!< Resources that exist in each timer */
+static const u8_t TIMER_Resources[NUM_OF_TIMERS] = {
+    TIMER_RES_COUNTER | TIMER_RES_OVERFLOW | TIMER_RES_OCA,
+    TIMER_RES_COUNTER | TIMER_RES_OVERFLOW | TIMER_RES_OCA | TIMER_RES_OCB | TIMER_RES_OCC | TIMER_RES_CAPTURE,
+    TIMER_RES_COUNTER | TIMER_RES_OVERFLOW | TIMER_RES_OCA,
+    TIMER_RES_COUNTER | TIMER_RES_OVERFLOW | TIMER_RES_OCA | TIMER_RES_OCB | TIMER_RES_OCC | TIMER_RES_CAPTURE,
+};
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                      PRIVATE FUNCTIONS PROTOTYPES                            */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static void TIMER_SetCallBack(void (** const destinationCallback)(void), 
+                              void (* const sourceCallback)(void));
+static BOOL_t TIMER_IsSupported(const TIMER_t timer, const TIMER_CLOCK_t clock, 
+                                const TIMER_MODE_t timerMode);
+static void TIMER0_ConfigClock(const TIMER_CLOCK_t clock);
+static void TIMER2_ConfigClock(const TIMER_CLOCK_t clock);
+static void TIMER8_ConfigMode(volatile u8_t * const TCCRn, const TIMER_MODE_t timerMode);
+static void TIMER8_ConfigOC(volatile u8_t * const TCCRn, const TIMER_MODE_t timerMode, 
+                            const TIMER_OC_t compareMode);
+static void TIMER16_ConfigOC(volatile u8_t * const TCCRnA, const TIMER_OCx_t OCx, 
+                             const TIMER_OC_t compareMode);
+static void TIMER16_ConfigClock(volatile u8_t * const TCCRnB, const TIMER_CLOCK_t timerClock);
+static void TIMER16_ConfigMode(volatile u8_t * const TCCRnA, volatile u8_t * const TCCRnB, 
+                               const TIMER_MODE_t timerMode);
+static void TIMER16_ConfigCapture(volatile u8_t * const TCCRnB, 
+                                  const TIMER_CAPTURE_EDGE_t edge, 
+                                  const TIMER_NOISE_CANCELER_t noiseCanceler);
+
 /*---------------------------------------------------------------------------*/
 /*                                                                           */
 /*                          PUBLIC FUNCTIONS OF TIMER0                       */
@@ -49,13 +96,13 @@ void TIMER0_Init(const u8_t u8_tInitValue, const TIMER_CLOCK_t clock,
                  const TIMER_MODE_t timerMode, const TIMER_OC_t compareMode) {
     TIMER0_SetTimer(u8_tInitValue);
     TIMER0_ConfigClock(clock);
-    TIMER0_ConfigMode(timerMode);
-    TIMER0_ConfigOC(timerMode, compareMode);
+    TIMER8_ConfigMode(&TCCR0, timerMode);
+    TIMER8_ConfigOC(&TCCR0, timerMode, compareMode);
 }
 
 void TIMER0_Disable(void) {
     TIMER0_ConfigClock(NO_CLOCK);
-    TIMER0_ConfigOC(TIMER_MODE_NORMAL, NO_OC);
+    TIMER8_ConfigOC(&TCCR0, TIMER_MODE_NORMAL, NO_OC);
 }
 
 void TIMER0_SetCompareValue(const u8_t u8_tCompareValue) {
@@ -111,14 +158,14 @@ void TIMER1_Init(const u16_t u16_tInitValue, const TIMER_CLOCK_t clock,
                  const TIMER_OCx_t OCx) {
 
     TIMER1_SetTimer(u16_tInitValue);
-    TIMER1_ConfigClock(clock);
-    TIMER1_ConfigMode(timerMode);
-    TIMER1_ConfigOC(OCx, compareMode);  
+    TIMER16_ConfigClock(&TCCR1B, clock);
+    TIMER16_ConfigMode(&TCCR1A, &TCCR1B, timerMode);
+    TIMER16_ConfigOC(&TCCR1A, OCx, compareMode);  
 }
 
 void TIMER1_Disable(const TIMER_OCx_t OCx) {
-    TIMER1_ConfigClock(NO_CLOCK);
-    TIMER1_ConfigOC(OCx, NO_OC);
+    TIMER16_ConfigClock(&TCCR1B, NO_CLOCK);
+    TIMER16_ConfigOC(&TCCR1A, OCx, NO_OC);
 }
 
 void TIMER1_SetCompareValue(const u16_t u16_tCompareValue, const TIMER_OCx_t OCx) {
@@ -234,6 +281,37 @@ void TIMER1_DisableCaptureInterrupt(void) {
     SREG = u8_tSreg;
 }
 
+void TIMER1_ConfigCapture(const TIMER_CAPTURE_EDGE_t edge, 
+                          const TIMER_NOISE_CANCELER_t noiseCanceler) {
+    TIMER16_ConfigCapture(&TCCR1B, edge, noiseCanceler);
+
+    TIMER_u8_tTIFR_REG = (1 << ICF1);    /*!< Changing the edge may set ICF1 */
+}
+
+void TIMER1_SetCaptureEdge(const TIMER_CAPTURE_EDGE_t edge) {
+    if(TIMER_CAPTURE_RISING_EDGE == edge) {
+        BIT_SET(TCCR1B, ICES1);
+    } else {
+        BIT_CLR(TCCR1B, ICES1);
+    }
+    TIMER_u8_tTIFR_REG = (1 << ICF1);    /*!< Changing the edge may set ICF1 */
+}
+
+u16_t TIMER1_GetCaptureValue(void) {
+    u16_t u16_tCaptureValue = 0;
+    const u8_t u8_tSreg = SREG;
+
+    GIE_Disable();
+
+    /* Lower register must be read first */
+    u16_tCaptureValue = (u16_t)ICR1L;
+    u16_tCaptureValue |= (u16_t)(ICR1H << 8);
+
+    SREG = u8_tSreg;
+
+    return (u16_tCaptureValue);
+}
+
 u16_t TIMER1_GetTimerValue(void) {
     u16_t u16_tTimerValue = 0;
     u8_t u8_tSreg = 0;
@@ -250,13 +328,195 @@ u16_t TIMER1_GetTimerValue(void) {
     return (u16_tTimerValue);
 }
 
+/*---------------------------------------------------------------------------*/
+/*                                                                           */
+/*                          PUBLIC FUNCTIONS OF TIMER2                       */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+
+void TIMER2_Init(const u8_t u8_tInitValue, const TIMER_CLOCK_t clock, 
+                 const TIMER_MODE_t timerMode, const TIMER_OC_t compareMode) {
+    TIMER2_SetTimer(u8_tInitValue);
+    TIMER2_ConfigClock(clock);
+    TIMER8_ConfigMode(&TCCR2, timerMode);
+    TIMER8_ConfigOC(&TCCR2, timerMode, compareMode);
+}
+
+void TIMER2_Disable(void) {
+    TIMER2_ConfigClock(NO_CLOCK);
+    TIMER8_ConfigOC(&TCCR2, TIMER_MODE_NORMAL, NO_OC);
+}
+
+void TIMER2_SetCompareValue(const u8_t u8_tCompareValue) {
+    OCR2 = u8_tCompareValue;
+}
+
+void TIMER2_SetTimer(const u8_t u8_tTimerValue) {
+    TCNT2 = u8_tTimerValue;
+}
+
+void TIMER2_EnableOverflowInterrupt(void (* const callback)(void)) {
+    GIE_Disable();
+
+    TIMER_SetCallBack(&TIMER2_OVF_CBK_PTR, callback);
+
+    /* Enable the overflow interrupt */
+    BIT_SET(TIMER_u8_tTIMSK_REG, TOIE2);
+
+    GIE_Enable();
+}
+
+void TIMER2_DisableOverflowInterrupt(void) {
+    BIT_CLR(TIMER_u8_tTIMSK_REG, TOIE2);
+}
+
+void TIMER2_EnableCompareMatchInterrupt(void (* const callback)(void)) {
+    GIE_Disable();
+
+    TIMER_SetCallBack(&TIMER2_COMP_CBK_PTR, callback);
+
+    /* Enable the compare match interrupt */
+    BIT_SET(TIMER_u8_tTIMSK_REG, OCIE2);
+
+    GIE_Enable();
+}
+
+void TIMER2_DisableCompareMatchInterrupt(void) {
+    BIT_CLR(TIMER_u8_tTIMSK_REG, OCIE2);
+}
+
+u8_t TIMER2_GetTimerValue(void) {
+    return TCNT2;
+}
+
+BOOL_t TIMER2_IsOverflowPending(void) {
+    return BIT_IS_SET(TIMER_u8_tTIFR_REG, TOV2) ? TRUE : FALSE;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                                                                           */
+/*                          PUBLIC FUNCTIONS OF TIMER3                       */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+
+void TIMER3_Init(const u16_t u16_tInitValue, const TIMER_CLOCK_t clock, 
+                 const TIMER_MODE_t timerMode, const TIMER_OC_t compareMode, 
+                 const TIMER_OCx_t OCx) {
+
+    TIMER3_SetTimer(u16_tInitValue);
+    TIMER16_ConfigClock(&TCCR3B, clock);
+    TIMER16_ConfigMode(&TCCR3A, &TCCR3B, timerMode);
+    TIMER16_ConfigOC(&TCCR3A, OCx, compareMode);  
+}
+
+void TIMER3_Disable(const TIMER_OCx_t OCx) {
+    TIMER16_ConfigClock(&TCCR3B, NO_CLOCK);
+    TIMER16_ConfigOC(&TCCR3A, OCx, NO_OC);
+}
+
+void TIMER3_SetTimer(const u16_t u16_tTimerValue) {
+    const u8_t u8_tSreg = SREG;
+
+    GIE_Disable();
+
+    /* Upper register must be written first */
+    TCNT3H = (u8_t)(u16_tTimerValue >> 8);
+    TCNT3L = (u8_t)(u16_tTimerValue);
+
+    SREG = u8_tSreg;
+}
+
+void TIMER3_EnableOverflowInterrupt(void (* const callback)(void)) {
+    GIE_Disable();
+
+    TIMER_SetCallBack(&TIMER3_OVF_CBK_PTR, callback);
+
+    /* Enable the overflow interrupt */
+    BIT_SET(TIMER_u8_tETIMSK_REG, TOIE3);
+
+    GIE_Enable();
+}
+
+void TIMER3_DisableOverflowInterrupt(void) {
+    BIT_CLR(TIMER_u8_tETIMSK_REG, TOIE3);  /*!< Disable the overflow interrupt */
+}
+
+void TIMER3_EnableCaptureInterrupt(void (* const callback)(void)) {
+    GIE_Disable();
+
+    TIMER_SetCallBack(&TIMER3_CAPT_CBK_PTR, callback);
+
+    /* Enable the capture interrupt */
+    BIT_SET(TIMER_u8_tETIMSK_REG, TICIE3);
+
+    GIE_Enable();
+}
+
+void TIMER3_DisableCaptureInterrupt(void) {
+    const u8_t u8_tSreg = SREG;
+
+    GIE_Disable();
+
+    /* Disable the capture interrupt */
+    BIT_CLR(TIMER_u8_tETIMSK_REG, TICIE3);
+
+    SREG = u8_tSreg;
+}
+
+void TIMER3_ConfigCapture(const TIMER_CAPTURE_EDGE_t edge, 
+                          const TIMER_NOISE_CANCELER_t noiseCanceler) {
+    TIMER16_ConfigCapture(&TCCR3B, edge, noiseCanceler);
+
+    TIMER_u8_tETIFR_REG = (1 << ICF3);   /*!< Changing the edge may set ICF3 */
+}
+
+void TIMER3_SetCaptureEdge(const TIMER_CAPTURE_EDGE_t edge) {
+    if(TIMER_CAPTURE_RISING_EDGE == edge) {
+        BIT_SET(TCCR3B, ICES3);
+    } else {
+        BIT_CLR(TCCR3B, ICES3);
+    }
+    TIMER_u8_tETIFR_REG = (1 << ICF3);   /*!< Changing the edge may set ICF3 */
+}
+
+u16_t TIMER3_GetCaptureValue(void) {
+    u16_t u16_tCaptureValue = 0;
+    const u8_t u8_tSreg = SREG;
+
+    GIE_Disable();
+
+    /* Lower register must be read first */
+    u16_tCaptureValue = (u16_t)ICR3L;
+    u16_tCaptureValue |= (u16_t)(ICR3H << 8);
+
+    SREG = u8_tSreg;
+
+    return (u16_tCaptureValue);
+}
+
+u16_t TIMER3_GetTimerValue(void) {
+    u16_t u16_tTimerValue = 0;
+    const u8_t u8_tSreg = SREG;
+
+    GIE_Disable();
+
+    /* Lower register must be read first */
+    u16_tTimerValue = (u16_t)TCNT3L;
+    u16_tTimerValue |= (u16_t)(TCNT3H << 8);
+
+    SREG = u8_tSreg;
+
+    return (u16_tTimerValue);
+}
+
 /*---------------------------------------------------------------------------*/
 /*                                                                           */
 /*                              PWM FUNCTIONS                                */
 /*                                                                           */
 /*---------------------------------------------------------------------------*/
 
-void PWM_Init(const PWM_t channel, const u32_t u32_tFrequency) {
+ERROR_t PWM_Init(const PWM_t channel, const u32_t u32_tFrequency) {
+    ERROR_t error = ERROR_OK;
     TIMER_CLOCK_t clock;
     u16_t prescaler = 0;
     
@@ -274,24 +534,43 @@ void PWM_Init(const PWM_t channel, const u32_t u32_tFrequency) {
         clock = F_CPU_CLOCK;
     }
 
+    /*!< Channels of the same timer share the counter if they use the same frequency */
     switch(channel) {
         case PWM_0:
-            TIMER0_Init(0, clock, TIMER_MODE_FAST_PWM, CLEAR_OC);
+            error |= TIMER_Reserve(TIMER_0, TIMER_RES_COUNTER | TIMER_RES_OCA, TIMER_USER_PWM, 
+                                   clock, TIMER_MODE_FAST_PWM);
+            if(ERROR_OK == error) {
+                TIMER0_Init(0, clock, TIMER_MODE_FAST_PWM, CLEAR_OC);
+            }
             break;
         case PWM_1:
-            TIMER1_Init(0, clock, TIMER_MODE_FAST_PWM_8, CLEAR_OC, TIMER_OCA);
+            error |= TIMER_Reserve(TIMER_1, TIMER_RES_COUNTER | TIMER_RES_OCA, TIMER_USER_PWM, 
+                                   clock, TIMER_MODE_FAST_PWM_8);
+            if(ERROR_OK == error) {
+                TIMER1_Init(0, clock, TIMER_MODE_FAST_PWM_8, CLEAR_OC, TIMER_OCA);
+            }
             break;
         case PWM_2:
-            TIMER1_Init(0, clock, TIMER_MODE_FAST_PWM_8, CLEAR_OC, TIMER_OCB);
+            error |= TIMER_Reserve(TIMER_1, TIMER_RES_COUNTER | TIMER_RES_OCB, TIMER_USER_PWM, 
+                                   clock, TIMER_MODE_FAST_PWM_8);
+            if(ERROR_OK == error) {
+                TIMER1_Init(0, clock, TIMER_MODE_FAST_PWM_8, CLEAR_OC, TIMER_OCB);
+            }
             break;
         case PWM_3:
-            TIMER1_Init(0, clock, TIMER_MODE_FAST_PWM_8, CLEAR_OC, TIMER_OCC);
+            error |= TIMER_Reserve(TIMER_1, TIMER_RES_COUNTER | TIMER_RES_OCC, TIMER_USER_PWM, 
+                                   clock, TIMER_MODE_FAST_PWM_8);
+            if(ERROR_OK == error) {
+                TIMER1_Init(0, clock, TIMER_MODE_FAST_PWM_8, CLEAR_OC, TIMER_OCC);
+            }
             break;
         /* TODO: implement cases for Timer 2 and 3  */
         default:
-            /* DEBUG    */
+            error |= ERROR_INVALID_PARAMETER;
             break;
     }
+
+    return error;
 }
 
 void PWM_Write(const PWM_t channel, const u8_t u8_tDutyCyclePercentage) {
@@ -325,14 +604,144 @@ void PWM_Write(const PWM_t channel, const u8_t u8_tDutyCyclePercentage) {
     }
 }
 
+/*---------------------------------------------------------------------------*/
+/*                                                                           */
+/*                          TIMERS ALLOCATION FUNCTIONS                      */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+
+ERROR_t TIMER_Reserve(const TIMER_t timer, const u8_t resources, const TIMER_USER_t user,
+                      const TIMER_CLOCK_t clock, const TIMER_MODE_t timerMode) {
+    ERROR_t error = ERROR_OK;
+    TIMER_ALLOCATION_t * allocation = NULL;
+    u8_t bit = 0;
+    u8_t u8_tSreg = 0;
+
+    if( (timer >= NUM_OF_TIMERS) || (TIMER_USER_NONE == user) || (user >= NUM_OF_TIMER_USERS) ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    if( (resources & ~TIMER_Resources[timer]) || (0 == resources) ) {
+        return ERROR_ILLEGAL_PARAM;
+    }
+
+    if( (resources & TIMER_RES_COUNTER) && (FALSE == TIMER_IsSupported(timer, clock, timerMode)) ) {
+        return ERROR_ILLEGAL_PARAM;
+    }
+
+    allocation = &TIMER_Allocations[timer];
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+
+    /*!< Check all resources first: nothing is reserved if one of them is busy */
+    if( (resources & TIMER_RES_COUNTER) && (allocation->counterUsers & ~((u16_t)1 << user)) ) {
+        if( (allocation->clock != clock) || (allocation->mode != timerMode) ) {
+            error |= ERROR_BUSY;
+        }
+    }
+
+    for(bit = 1; bit < 8; ++bit) {
+        if( BIT_IS_SET(resources, bit) && 
+            (TIMER_USER_NONE != allocation->owners[bit]) && (user != allocation->owners[bit]) ) {
+            error |= ERROR_BUSY;
+        }
+    }
+
+    if(ERROR_OK == error) {
+        if(resources & TIMER_RES_COUNTER) {
+            allocation->counterUsers |= ((u16_t)1 << user);
+            allocation->clock = clock;
+            allocation->mode  = timerMode;
+        }
+
+        for(bit = 1; bit < 8; ++bit) {
+            if( BIT_IS_SET(resources, bit) ) {
+                allocation->owners[bit] = user;
+            }
+        }
+    }
+
+    SREG = u8_tSreg;
+
+    return error;
+}
+
+ERROR_t TIMER_Release(const TIMER_t timer, const u8_t resources, const TIMER_USER_t user) {
+    ERROR_t error = ERROR_OK;
+    TIMER_ALLOCATION_t * allocation = NULL;
+    u8_t bit = 0;
+    u8_t u8_tSreg = 0;
+
+    if( (timer >= NUM_OF_TIMERS) || (TIMER_USER_NONE == user) || (user >= NUM_OF_TIMER_USERS) ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    allocation = &TIMER_Allocations[timer];
+
+    u8_tSreg = SREG;
+    GIE_Disable();
+
+    if(resources & TIMER_RES_COUNTER) {
+        allocation->counterUsers &= ~((u16_t)1 << user);
+    }
+
+    for(bit = 1; bit < 8; ++bit) {
+        if( BIT_IS_SET(resources, bit) ) {
+            if(user == allocation->owners[bit]) {
+                allocation->owners[bit] = TIMER_USER_NONE;
+            } else if(TIMER_USER_NONE != allocation->owners[bit]) {
+                error |= ERROR_BUSY;
+            } else {
+                /* Already free */
+            }
+        }
+    }
+
+    SREG = u8_tSreg;
+
+    return error;
+}
+
+TIMER_USER_t TIMER_GetOwner(const TIMER_t timer, const TIMER_RESOURCE_t resource) {
+    TIMER_USER_t owner = TIMER_USER_NONE;
+    u8_t bit = 0;
+
+    if( (timer < NUM_OF_TIMERS) && (TIMER_RES_COUNTER != resource) ) {
+        for(bit = 1; bit < 8; ++bit) {
+            if( (u8_t)resource == (1 << bit) ) {
+                owner = TIMER_Allocations[timer].owners[bit];
+                break;
+            }
+        }
+    }
+
+    return owner;
+}
+
+u8_t TIMER_GetCounterUsers(const TIMER_t timer) {
+    u8_t users = 0;
+    u16_t counterUsers = 0;
+
+    if(timer < NUM_OF_TIMERS) {
+        counterUsers = TIMER_Allocations[timer].counterUsers;
+        while(0 != counterUsers) {
+            users += (counterUsers & 1);
+            counterUsers >>= 1;
+        }
+    }
+
+    return users;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                                                                           */
 /*                   PRIVATE FUNCTIONS (GENERIC)                             */
 /*                                                                           */
 /*---------------------------------------------------------------------------*/
 
-static void TIMER_SetCallBack(void (*destinationCallback)(void), 
-                              void (*const sourceCallback)(void)) {
+static void TIMER_SetCallBack(void (** const destinationCallback)(void), 
+                              void (* const sourceCallback)(void)) {
     if(sourceCallback != NULL) {
         *destinationCallback = sourceCallback;
     } else {
@@ -340,6 +749,34 @@ static void TIMER_SetCallBack(void (*destinationCallback)(void),
     }
 }
 
+/******************************************************************************
+ * @brief Check that the timer supports the clock and the mode.
+ * @note  - F_CPU_32 and F_CPU_128 exist for TIMER0 only.
+ *        - TIMER0 has no external clock pin (it uses TOSC1 instead).
+ *        - 8-bit timers do not have the 16-bit modes and vice versa.
+ *****************************************************************************/
+static BOOL_t TIMER_IsSupported(const TIMER_t timer, const TIMER_CLOCK_t clock, 
+                                const TIMER_MODE_t timerMode) {
+    BOOL_t isSupported = TRUE;
+    const BOOL_t is8Bit = ( (TIMER_0 == timer) || (TIMER_2 == timer) ) ? TRUE : FALSE;
+    const BOOL_t is8BitMode = ( (TIMER_MODE_CTC == timerMode) || 
+                                (TIMER_MODE_FAST_PWM == timerMode) || 
+                                (TIMER_MODE_PHASE_CORRECT_PWM == timerMode) ) ? TRUE : FALSE;
+
+    if( (TIMER_0 != timer) && ( (F_CPU_32 == clock) || (F_CPU_128 == clock) ) ) {
+        isSupported = FALSE;
+    } else if( (TIMER_0 == timer) && 
+               ( (F_CPU_EXT_CLK_FALLING == clock) || (F_CPU_EXT_CLK_RISING == clock) ) ) {
+        isSupported = FALSE;
+    } else if( (TIMER_MODE_NORMAL != timerMode) && (is8Bit != is8BitMode) ) {
+        isSupported = FALSE;
+    } else {
+        /* Supported */
+    }
+
+    return isSupported;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                                                                           */
 /*                   PRIVATE FUNCTIONS OF TIMER0                             */
@@ -394,25 +831,87 @@ static void TIMER0_ConfigClock(const TIMER_CLOCK_t clock) {
     }
 }
 
-static void TIMER0_ConfigMode(const TIMER_MODE_t timerMode) {
+/*---------------------------------------------------------------------------*/
+/*                                                                           */
+/*                   PRIVATE FUNCTIONS OF TIMER2                             */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+
+static void TIMER2_ConfigClock(const TIMER_CLOCK_t clock) {
+    switch(clock) {
+        case NO_CLOCK:
+            BIT_CLR(TCCR2, CS20);
+            BIT_CLR(TCCR2, CS21);
+            BIT_CLR(TCCR2, CS22);
+            break;
+        case F_CPU_CLOCK:
+            BIT_SET(TCCR2, CS20);
+            BIT_CLR(TCCR2, CS21);
+            BIT_CLR(TCCR2, CS22);
+            break;
+        case F_CPU_8:
+            BIT_CLR(TCCR2, CS20);
+            BIT_SET(TCCR2, CS21);
+            BIT_CLR(TCCR2, CS22);
+            break;
+        case F_CPU_64:
+            BIT_SET(TCCR2, CS20);
+            BIT_SET(TCCR2, CS21);
+            BIT_CLR(TCCR2, CS22);
+            break;
+        case F_CPU_256:
+            BIT_CLR(TCCR2, CS20);
+            BIT_CLR(TCCR2, CS21);
+            BIT_SET(TCCR2, CS22);
+            break;
+        case F_CPU_1024:
+            BIT_SET(TCCR2, CS20);
+            BIT_CLR(TCCR2, CS21);
+            BIT_SET(TCCR2, CS22);
+            break;
+        case F_CPU_EXT_CLK_FALLING:
+            BIT_CLR(TCCR2, CS20);
+            BIT_SET(TCCR2, CS21);
+            BIT_SET(TCCR2, CS22);
+            break;
+        case F_CPU_EXT_CLK_RISING:
+            BIT_SET(TCCR2, CS20);
+            BIT_SET(TCCR2, CS21);
+            BIT_SET(TCCR2, CS22);
+            break;
+        default:
+            /* TODO: DEBUG    */
+            break;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*                                                                           */
+/*              PRIVATE FUNCTIONS OF 8-BIT TIMERS (TIMER0, TIMER2)           */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/* TIMER0 and TIMER2 share the same bit layout of TCCRn except the clock
+   select bits, so the bit names of TIMER0 are used for both of them */
+
+static void TIMER8_ConfigMode(volatile u8_t * const TCCRn, const TIMER_MODE_t timerMode) {
     switch(timerMode) {
         case TIMER_MODE_NORMAL:       
-            BIT_CLR(TCCR0, WGM00);
-            BIT_CLR(TCCR0, WGM01);
-            BIT_SET(TCCR0, FOC0);   /*!< Set force output compare mode with non-PWM mode */
+            BIT_CLR(*TCCRn, WGM00);
+            BIT_CLR(*TCCRn, WGM01);
+            BIT_SET(*TCCRn, FOC0);   /*!< Set force output compare mode with non-PWM mode */
             break;
         case TIMER_MODE_CTC:         
-            BIT_CLR(TCCR0, WGM00);
-            BIT_SET(TCCR0, WGM01);
-            BIT_SET(TCCR0, FOC0);   /*!< Set force output compare mode with non-PWM mode */
+            BIT_CLR(*TCCRn, WGM00);
+            BIT_SET(*TCCRn, WGM01);
+            BIT_SET(*TCCRn, FOC0);   /*!< Set force output compare mode with non-PWM mode */
             break;
         case TIMER_MODE_FAST_PWM:   
-            BIT_SET(TCCR0, WGM00);
-            BIT_SET(TCCR0, WGM01);
+            BIT_SET(*TCCRn, WGM00);
+            BIT_SET(*TCCRn, WGM01);
             break;
         case TIMER_MODE_PHASE_CORRECT_PWM:
-            BIT_SET(TCCR0, WGM00);
-            BIT_CLR(TCCR0, WGM01);
+            BIT_SET(*TCCRn, WGM00);
+            BIT_CLR(*TCCRn, WGM01);
             break;
         default:                
             /* TODO: DEBUG    */
@@ -420,28 +919,29 @@ static void TIMER0_ConfigMode(const TIMER_MODE_t timerMode) {
     }
 }
 
-static void TIMER0_ConfigOC(const TIMER_MODE_t timerMode, const TIMER_OC_t compareMode) {
+static void TIMER8_ConfigOC(volatile u8_t * const TCCRn, const TIMER_MODE_t timerMode, 
+                            const TIMER_OC_t compareMode) {
     switch(compareMode) {
         case NO_OC:
-            BIT_CLR(TCCR0, COM00);
-            BIT_CLR(TCCR0, COM01);
+            BIT_CLR(*TCCRn, COM00);
+            BIT_CLR(*TCCRn, COM01);
             break;
         case TOGGLE_OC:
             if((timerMode == TIMER_MODE_NORMAL) || (timerMode == TIMER_MODE_CTC)) {
-                BIT_SET(TCCR0, COM00);
-                BIT_CLR(TCCR0, COM01);
+                BIT_SET(*TCCRn, COM00);
+                BIT_CLR(*TCCRn, COM01);
             }
             else{
                 /* TODO: DEBUG    */
             }
             break;
         case CLEAR_OC:
-            BIT_CLR(TCCR0, COM00);
-            BIT_SET(TCCR0, COM01);
+            BIT_CLR(*TCCRn, COM00);
+            BIT_SET(*TCCRn, COM01);
             break;
         case SET_OC:  
-            BIT_SET(TCCR0, COM00);
-            BIT_SET(TCCR0, COM01);
+            BIT_SET(*TCCRn, COM00);
+            BIT_SET(*TCCRn, COM01);
             break;
         default:
             /* TODO: DEBUG    */
@@ -452,11 +952,14 @@ static void TIMER0_ConfigOC(const TIMER_MODE_t timerMode, const TIMER_OC_t compa
 
 /*---------------------------------------------------------------------------*/
 /*                                                                           */
-/*                   PRIVATE FUNCTIONS OF TIMER1                             */
+/*              PRIVATE FUNCTIONS OF 16-BIT TIMERS (TIMER1, TIMER3)          */
 /*                                                                           */
 /*---------------------------------------------------------------------------*/
+/* TIMER1 and TIMER3 share the same bit layout of TCCRnA and TCCRnB, so the
+   bit names of TIMER1 are used for both of them */
 
-static void TIMER1_ConfigOC(const TIMER_OCx_t OCx, const TIMER_OC_t compareMode) {
+static void TIMER16_ConfigOC(volatile u8_t * const TCCRnA, const TIMER_OCx_t OCx, 
+                             const TIMER_OC_t compareMode) {
     u8_t u8_tCom1x0 = 0, u8_tCom1x1 = 0;
 
     switch(OCx) {
@@ -478,12 +981,12 @@ static void TIMER1_ConfigOC(const TIMER_OCx_t OCx, const TIMER_OC_t compareMode)
 
     switch(compareMode) {
         case NO_OC:
-            BIT_CLR(TCCR1A, u8_tCom1x0);
-            BIT_CLR(TCCR1A, u8_tCom1x1);
+            BIT_CLR(*TCCRnA, u8_tCom1x0);
+            BIT_CLR(*TCCRnA, u8_tCom1x1);
             break;
         case TOGGLE_OC:
-            BIT_SET(TCCR1A, u8_tCom1x0);
-            BIT_CLR(TCCR1A, u8_tCom1x1);
+            BIT_SET(*TCCRnA, u8_tCom1x0);
+            BIT_CLR(*TCCRnA, u8_tCom1x1);
             /* 
                 WGMn3:0 = 15: Toggle OCA on Compare Match, OCB/OCC disconnected 
                 (normal port operation).
@@ -498,156 +1001,184 @@ static void TIMER1_ConfigOC(const TIMER_OCx_t OCx, const TIMER_OC_t compareMode)
             */
             break;
         case CLEAR_OC:
-            BIT_CLR(TCCR1A, u8_tCom1x0);
-            BIT_SET(TCCR1A, u8_tCom1x1);
+            BIT_CLR(*TCCRnA, u8_tCom1x0);
+            BIT_SET(*TCCRnA, u8_tCom1x1);
             break;
         case SET_OC:
-            BIT_SET(TCCR1A, u8_tCom1x0);
-            BIT_SET(TCCR1A, u8_tCom1x1);
+            BIT_SET(*TCCRnA, u8_tCom1x0);
+            BIT_SET(*TCCRnA, u8_tCom1x1);
             break;
         default:
             break;
     }
 }
 
-static void TIMER1_ConfigClock(const TIMER_CLOCK_t timerClock) {
+static void TIMER16_ConfigClock(volatile u8_t * const TCCRnB, const TIMER_CLOCK_t timerClock) {
     switch(timerClock) {
         case NO_CLOCK:
-            BIT_CLR(TCCR1B, CS10);
-            BIT_CLR(TCCR1B, CS11);
-            BIT_CLR(TCCR1B, CS12);
+            BIT_CLR(*TCCRnB, CS10);
+            BIT_CLR(*TCCRnB, CS11);
+            BIT_CLR(*TCCRnB, CS12);
             break;
         case F_CPU_CLOCK:
-            BIT_SET(TCCR1B, CS10);
-            BIT_CLR(TCCR1B, CS11);
-            BIT_CLR(TCCR1B, CS12);
+            BIT_SET(*TCCRnB, CS10);
+            BIT_CLR(*TCCRnB, CS11);
+            BIT_CLR(*TCCRnB, CS12);
             break;
         case F_CPU_8:
-            BIT_CLR(TCCR1B, CS10);
-            BIT_SET(TCCR1B, CS11);
-            BIT_CLR(TCCR1B, CS12);
+            BIT_CLR(*TCCRnB, CS10);
+            BIT_SET(*TCCRnB, CS11);
+            BIT_CLR(*TCCRnB, CS12);
             break;
         case F_CPU_64:
-            BIT_SET(TCCR1B, CS10);
-            BIT_SET(TCCR1B, CS11);
-            BIT_CLR(TCCR1B, CS12);
+            BIT_SET(*TCCRnB, CS10);
+            BIT_SET(*TCCRnB, CS11);
+            BIT_CLR(*TCCRnB, CS12);
             break;
         case F_CPU_256:
-            BIT_CLR(TCCR1B, CS10);
-            BIT_CLR(TCCR1B, CS11);
-            BIT_SET(TCCR1B, CS12);
+            BIT_CLR(*TCCRnB, CS10);
+            BIT_CLR(*TCCRnB, CS11);
+            BIT_SET(*TCCRnB, CS12);
             break;
         case F_CPU_1024:
-            BIT_SET(TCCR1B, CS10);
-            BIT_CLR(TCCR1B, CS11);
-            BIT_SET(TCCR1B, CS12);
+            BIT_SET(*TCCRnB, CS10);
+            BIT_CLR(*TCCRnB, CS11);
+            BIT_SET(*TCCRnB, CS12);
             break;
         case F_CPU_EXT_CLK_FALLING:
-            BIT_CLR(TCCR1B, CS10);
-            BIT_SET(TCCR1B, CS11);
-            BIT_SET(TCCR1B, CS12);
+            BIT_CLR(*TCCRnB, CS10);
+            BIT_SET(*TCCRnB, CS11);
+            BIT_SET(*TCCRnB, CS12);
             break;
         case F_CPU_EXT_CLK_RISING:
-            BIT_SET(TCCR1B, CS10);
-            BIT_SET(TCCR1B, CS11);
-            BIT_SET(TCCR1B, CS12);
+            BIT_SET(*TCCRnB, CS10);
+            BIT_SET(*TCCRnB, CS11);
+            BIT_SET(*TCCRnB, CS12);
             break;
         default:
             break;
     }
 }
 
-static void TIMER1_ConfigMode(const TIMER_MODE_t timerMode) {
+static void TIMER16_ConfigMode(volatile u8_t * const TCCRnA, volatile u8_t * const TCCRnB, 
+                               const TIMER_MODE_t timerMode) {
     switch(timerMode) {
         case TIMER_MODE_NORMAL:
-            BIT_CLR(TCCR1A, WGM10);
-            BIT_CLR(TCCR1A, WGM11);
-            BIT_CLR(TCCR1B, WGM12);
-            BIT_CLR(TCCR1B, WGM13);
+            BIT_CLR(*TCCRnA, WGM10);
+            BIT_CLR(*TCCRnA, WGM11);
+            BIT_CLR(*TCCRnB, WGM12);
+            BIT_CLR(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_PHASE_CORRECT_PWM_8:
-            BIT_SET(TCCR1A, WGM10);
-            BIT_CLR(TCCR1A, WGM11);
-            BIT_CLR(TCCR1B, WGM12);
-            BIT_CLR(TCCR1B, WGM13);
+            BIT_SET(*TCCRnA, WGM10);
+            BIT_CLR(*TCCRnA, WGM11);
+            BIT_CLR(*TCCRnB, WGM12);
+            BIT_CLR(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_PHASE_CORRECT_PWM_9:    
-            BIT_CLR(TCCR1A, WGM10);
-            BIT_SET(TCCR1A, WGM11);
-            BIT_CLR(TCCR1B, WGM12);
-            BIT_CLR(TCCR1B, WGM13);
+            BIT_CLR(*TCCRnA, WGM10);
+            BIT_SET(*TCCRnA, WGM11);
+            BIT_CLR(*TCCRnB, WGM12);
+            BIT_CLR(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_PHASE_CORRECT_PWM_10:   
-            BIT_SET(TCCR1A, WGM10);
-            BIT_SET(TCCR1A, WGM11);
-            BIT_CLR(TCCR1B, WGM12);
-            BIT_CLR(TCCR1B, WGM13);
+            BIT_SET(*TCCRnA, WGM10);
+            BIT_SET(*TCCRnA, WGM11);
+            BIT_CLR(*TCCRnB, WGM12);
+            BIT_CLR(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_CTC_OCR:                
-            BIT_CLR(TCCR1A, WGM10);
-            BIT_CLR(TCCR1A, WGM11);
-            BIT_SET(TCCR1B, WGM12);
-            BIT_CLR(TCCR1B, WGM13);
+            BIT_CLR(*TCCRnA, WGM10);
+            BIT_CLR(*TCCRnA, WGM11);
+            BIT_SET(*TCCRnB, WGM12);
+            BIT_CLR(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_FAST_PWM_8:             
-            BIT_SET(TCCR1A, WGM10);
-            BIT_CLR(TCCR1A, WGM11);
-            BIT_SET(TCCR1B, WGM12);
-            BIT_CLR(TCCR1B, WGM13);
+            BIT_SET(*TCCRnA, WGM10);
+            BIT_CLR(*TCCRnA, WGM11);
+            BIT_SET(*TCCRnB, WGM12);
+            BIT_CLR(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_FAST_PWM_9:             
-            BIT_CLR(TCCR1A, WGM10);
-            BIT_SET(TCCR1A, WGM11);
-            BIT_SET(TCCR1B, WGM12);
-            BIT_CLR(TCCR1B, WGM13);
+            BIT_CLR(*TCCRnA, WGM10);
+            BIT_SET(*TCCRnA, WGM11);
+            BIT_SET(*TCCRnB, WGM12);
+            BIT_CLR(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_FAST_PWM_10:            
-            BIT_SET(TCCR1A, WGM10);
-            BIT_SET(TCCR1A, WGM11);
-            BIT_SET(TCCR1B, WGM12);
-            BIT_CLR(TCCR1B, WGM13);
+            BIT_SET(*TCCRnA, WGM10);
+            BIT_SET(*TCCRnA, WGM11);
+            BIT_SET(*TCCRnB, WGM12);
+            BIT_CLR(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_PHASE_FREQ_CORRECT_ICR: 
-            BIT_CLR(TCCR1A, WGM10);
-            BIT_CLR(TCCR1A, WGM11);
-            BIT_CLR(TCCR1B, WGM12);
-            BIT_SET(TCCR1B, WGM13);
+            BIT_CLR(*TCCRnA, WGM10);
+            BIT_CLR(*TCCRnA, WGM11);
+            BIT_CLR(*TCCRnB, WGM12);
+            BIT_SET(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_PHASE_FREQ_CORRECT_OCR: 
-            BIT_SET(TCCR1A, WGM10);
-            BIT_CLR(TCCR1A, WGM11);
-            BIT_CLR(TCCR1B, WGM12);
-            BIT_SET(TCCR1B, WGM13);
+            BIT_SET(*TCCRnA, WGM10);
+            BIT_CLR(*TCCRnA, WGM11);
+            BIT_CLR(*TCCRnB, WGM12);
+            BIT_SET(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_PHASE_CORRECT_PWM_ICR:  
-            BIT_CLR(TCCR1A, WGM10);
-            BIT_SET(TCCR1A, WGM11);
-            BIT_CLR(TCCR1B, WGM12);
-            BIT_SET(TCCR1B, WGM13);
+            BIT_CLR(*TCCRnA, WGM10);
+            BIT_SET(*TCCRnA, WGM11);
+            BIT_CLR(*TCCRnB, WGM12);
+            BIT_SET(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_PHASE_CORRECT_PWM_OCR:  
-            BIT_SET(TCCR1A, WGM10);
-            BIT_SET(TCCR1A, WGM11);
-            BIT_CLR(TCCR1B, WGM12);
-            BIT_SET(TCCR1B, WGM13);
+            BIT_SET(*TCCRnA, WGM10);
+            BIT_SET(*TCCRnA, WGM11);
+            BIT_CLR(*TCCRnB, WGM12);
+            BIT_SET(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_CTC_ICR:                
-            BIT_CLR(TCCR1A, WGM10);
-            BIT_CLR(TCCR1A, WGM11);
-            BIT_SET(TCCR1B, WGM12);
-            BIT_SET(TCCR1B, WGM13);
+            BIT_CLR(*TCCRnA, WGM10);
+            BIT_CLR(*TCCRnA, WGM11);
+            BIT_SET(*TCCRnB, WGM12);
+            BIT_SET(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_FAST_PWM_ICR:           
-            BIT_CLR(TCCR1A, WGM10);
-            BIT_SET(TCCR1A, WGM11);
-            BIT_SET(TCCR1B, WGM12);
-            BIT_SET(TCCR1B, WGM13);
+            BIT_CLR(*TCCRnA, WGM10);
+            BIT_SET(*TCCRnA, WGM11);
+            BIT_SET(*TCCRnB, WGM12);
+            BIT_SET(*TCCRnB, WGM13);
             break;
         case TIMER_MODE_FAST_PWM_OCR:           
-            BIT_SET(TCCR1A, WGM10);
-            BIT_SET(TCCR1A, WGM11);
-            BIT_SET(TCCR1B, WGM12);
-            BIT_SET(TCCR1B, WGM13);
+            BIT_SET(*TCCRnA, WGM10);
+            BIT_SET(*TCCRnA, WGM11);
+            BIT_SET(*TCCRnB, WGM12);
+            BIT_SET(*TCCRnB, WGM13);
+            break;
+        default:
+            break;
+    }
+}
+
+
+static void TIMER16_ConfigCapture(volatile u8_t * const TCCRnB, 
+                                  const TIMER_CAPTURE_EDGE_t edge, 
+                                  const TIMER_NOISE_CANCELER_t noiseCanceler) {
+    switch(edge) {
+        case TIMER_CAPTURE_FALLING_EDGE:
+            BIT_CLR(*TCCRnB, ICES1);
+            break;
+        case TIMER_CAPTURE_RISING_EDGE:
+            BIT_SET(*TCCRnB, ICES1);
+            break;
+        default:
+            break;
+    }
+
+    switch(noiseCanceler) {
+        case TIMER_NOISE_CANCELER_OFF:
+            BIT_CLR(*TCCRnB, ICNC1);
+            break;
+        case TIMER_NOISE_CANCELER_ON:
+            BIT_SET(*TCCRnB, ICNC1);     /*!< Delays the capture by 4 timer clocks */
             break;
         default:
             break;
@@ -661,14 +1192,44 @@ static void TIMER1_ConfigMode(const TIMER_MODE_t timerMode) {
 /*                                                                           */
 /*---------------------------------------------------------------------------*/
 
+#if (TIMER_HANDLERS_BINDING == BINDING_STATIC)
+/* Handlers are bound at link time: the application overrides the weak ones */
+#define TIMER_DISPATCH(NAME)    NAME##_Handler()
+
+static void TIMER_DefaultHandler(void) {
+    /* Interrupt enabled without a handler: nothing to do */
+}
+
+void TIMER0_COMP_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER0_OVF_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER1_CAPT_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER1_COMPA_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER1_COMPB_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER1_COMPC_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER1_OVF_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER2_COMP_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER2_OVF_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER3_CAPT_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER3_COMPA_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER3_COMPB_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER3_COMPC_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+void TIMER3_OVF_Handler(void) __attribute__((weak, alias("TIMER_DefaultHandler")));
+#else
+#define TIMER_DISPATCH(NAME)    NAME##_CBK_PTR()
+#endif
+
+/* Flags are cleared by writing 1 to the flag only: a read-modify-write of
+   TIFR/ETIFR would clear the other pending flags too (e.g. TOV1 while
+   capturing) */
+
 /* ISR of TIMER0 Overflow */
 void __vector_16(void) __attribute__((signal));
 void __vector_16(void) {
     GIE_Disable();
 
-    TIMER0_OVF_CBK_PTR();
+    TIMER_DISPATCH(TIMER0_OVF);
 
-    BIT_SET(TIMER_u8_tTIFR_REG, TOV0);    /*!< Clear the interrupt flag */
+    TIMER_u8_tTIFR_REG = (1 << TOV0);    /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -678,9 +1239,9 @@ void __vector_15(void) __attribute__((signal));
 void __vector_15(void) {
     GIE_Disable();
 
-    TIMER0_COMP_CBK_PTR();
+    TIMER_DISPATCH(TIMER0_COMP);
 
-    BIT_SET(TIMER_u8_tTIFR_REG, OCF0);    /*!< Clear the interrupt flag */
+    TIMER_u8_tTIFR_REG = (1 << OCF0);    /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -690,9 +1251,9 @@ void __vector_14(void) __attribute__((signal));
 void __vector_14(void) {
     GIE_Disable();
 
-    TIMER1_OVF_CBK_PTR();
+    TIMER_DISPATCH(TIMER1_OVF);
 
-    BIT_SET(TIMER_u8_tTIFR_REG, TOV1);    /*!< Clear the interrupt flag */
+    TIMER_u8_tTIFR_REG = (1 << TOV1);    /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -702,9 +1263,9 @@ void __vector_13(void) __attribute__((signal));
 void __vector_13(void) {
     GIE_Disable();
 
-    TIMER1_COMPB_CBK_PTR();
+    TIMER_DISPATCH(TIMER1_COMPB);
 
-    BIT_SET(TIMER_u8_tTIFR_REG, OCF1B);   /*!< Clear the interrupt flag */
+    TIMER_u8_tTIFR_REG = (1 << OCF1B);   /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -714,9 +1275,9 @@ void __vector_12(void) __attribute__((signal));
 void __vector_12(void) {
     GIE_Disable();
 
-    TIMER1_COMPA_CBK_PTR();
+    TIMER_DISPATCH(TIMER1_COMPA);
 
-    BIT_SET(TIMER_u8_tTIFR_REG, OCF1A);   /*!< Clear the interrupt flag */
+    TIMER_u8_tTIFR_REG = (1 << OCF1A);   /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -726,9 +1287,9 @@ void __vector_24(void) __attribute__((signal));
 void __vector_24(void) {
     GIE_Disable();
 
-    TIMER1_COMPC_CBK_PTR();
+    TIMER_DISPATCH(TIMER1_COMPC);
 
-    BIT_SET(TIMER_u8_tETIFR_REG, OCF1C);  /*!< Clear the interrupt flag */
+    TIMER_u8_tETIFR_REG = (1 << OCF1C);  /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -738,9 +1299,9 @@ void __vector_11(void) __attribute__((signal));
 void __vector_11(void) {
     GIE_Disable();
 
-    TIMER1_CAPT_CBK_PTR();
+    TIMER_DISPATCH(TIMER1_CAPT);
 
-    BIT_SET(TIMER_u8_tTIFR_REG, ICF1);    /*!< Clear the interrupt flag */
+    TIMER_u8_tTIFR_REG = (1 << ICF1);    /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -750,9 +1311,9 @@ void __vector_10(void) __attribute__((signal));
 void __vector_10(void) {
     GIE_Disable();
 
-    TIMER2_OVF_CBK_PTR();
+    TIMER_DISPATCH(TIMER2_OVF);
 
-    BIT_SET(TIMER_u8_tTIFR_REG, TOV2);    /*!< Clear the interrupt flag */
+    TIMER_u8_tTIFR_REG = (1 << TOV2);    /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -762,9 +1323,9 @@ void __vector_9(void) __attribute__((signal));
 void __vector_9(void) {
     GIE_Disable();
 
-    TIMER2_COMP_CBK_PTR();
+    TIMER_DISPATCH(TIMER2_COMP);
 
-    BIT_SET(TIMER_u8_tTIFR_REG, OCF2);    /*!< Clear the interrupt flag */
+    TIMER_u8_tTIFR_REG = (1 << OCF2);    /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -774,9 +1335,9 @@ void __vector_29(void) __attribute__((signal));
 void __vector_29(void) {
     GIE_Disable();
 
-    TIMER3_OVF_CBK_PTR();
+    TIMER_DISPATCH(TIMER3_OVF);
 
-    BIT_SET(TIMER_u8_tETIFR_REG, TOV3);   /*!< Clear the interrupt flag */
+    TIMER_u8_tETIFR_REG = (1 << TOV3);   /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -786,9 +1347,9 @@ void __vector_28(void) __attribute__((signal));
 void __vector_28(void) {
     GIE_Disable();
 
-    TIMER3_COMPC_CBK_PTR();
+    TIMER_DISPATCH(TIMER3_COMPC);
 
-    BIT_SET(TIMER_u8_tETIFR_REG, OCF3C);  /*!< Clear the interrupt flag */
+    TIMER_u8_tETIFR_REG = (1 << OCF3C);  /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -798,9 +1359,9 @@ void __vector_27(void) __attribute__((signal));
 void __vector_27(void) {
     GIE_Disable();
 
-    TIMER3_COMPB_CBK_PTR();
+    TIMER_DISPATCH(TIMER3_COMPB);
 
-    BIT_SET(TIMER_u8_tETIFR_REG, OCF3B);  /*!< Clear the interrupt flag */
+    TIMER_u8_tETIFR_REG = (1 << OCF3B);  /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -810,9 +1371,9 @@ void __vector_26(void) __attribute__((signal));
 void __vector_26(void) {
     GIE_Disable();
 
-    TIMER3_COMPA_CBK_PTR();
+    TIMER_DISPATCH(TIMER3_COMPA);
 
-    BIT_SET(TIMER_u8_tETIFR_REG, OCF3A);  /*!< Clear the interrupt flag */
+    TIMER_u8_tETIFR_REG = (1 << OCF3A);  /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -822,9 +1383,9 @@ void __vector_25(void) __attribute__((signal));
 void __vector_25(void) {
     GIE_Disable();
 
-    TIMER3_CAPT_CBK_PTR();
+    TIMER_DISPATCH(TIMER3_CAPT);
 
-    BIT_SET(TIMER_u8_tETIFR_REG, ICF3);   /*!< Clear the interrupt flag */
+    TIMER_u8_tETIFR_REG = (1 << ICF3);   /*!< Clear the interrupt flag */
 
     GIE_Enable();
 }
@@ -62,6 +62,16 @@ typedef enum {
     TIMER_OCC,     /* Output Compare C */
 }TIMER_OCx_t;
 
+typedef enum {
+    TIMER_CAPTURE_FALLING_EDGE,     /* Capture on the falling edge of ICPn pin */
+    TIMER_CAPTURE_RISING_EDGE,      /* Capture on the rising edge of ICPn pin */
+}TIMER_CAPTURE_EDGE_t;
+
+typedef enum {
+    TIMER_NOISE_CANCELER_OFF,       /* Capture as soon as the edge is detected */
+    TIMER_NOISE_CANCELER_ON,        /* Edge must be stable for 4 samples: delays the capture by 4 clocks */
+}TIMER_NOISE_CANCELER_t;
+
 typedef enum {
     PWM_0,    /* Connected with pin --> OC0      */
     PWM_1,    /* Connected with pin --> OC1A     */
@@ -73,6 +83,44 @@ typedef enum {
     PWM_7,    /* Connected with pin --> OC3C     */
 }PWM_t;
 
+typedef enum {
+    TIMER_0,        /* 8-bit timer: OC0, asynchronous (TOSC) clock */
+    TIMER_1,        /* 16-bit timer: OC1A, OC1B, OC1C, ICP1 */
+    TIMER_2,        /* 8-bit timer: OC2 */
+    TIMER_3,        /* 16-bit timer: OC3A, OC3B, OC3C, ICP3 */
+    NUM_OF_TIMERS
+}TIMER_t;
+
+/******************************************************************************
+ * @brief   Resources of a timer that can be reserved. They are bit masks, so
+ *          more than one resource can be reserved at once:
+ *          (TIMER_RES_COUNTER | TIMER_RES_OVERFLOW)
+ * @note    - TIMER_RES_COUNTER (clock and mode) is shared by all users that
+ *            request the same clock and mode.
+ *          - The other resources are owned by one user only.
+ ******************************************************************************/
+typedef enum {
+    TIMER_RES_COUNTER   = 0x01,     /* Clock and mode of the counter */
+    TIMER_RES_OVERFLOW  = 0x02,     /* Overflow interrupt, TCNTn value */
+    TIMER_RES_OCA       = 0x04,     /* Output compare A (OC0/OC2 for 8-bit timers) */
+    TIMER_RES_OCB       = 0x08,     /* Output compare B */
+    TIMER_RES_OCC       = 0x10,     /* Output compare C */
+    TIMER_RES_CAPTURE   = 0x20,     /* Input capture unit */
+}TIMER_RESOURCE_t;
+
+typedef enum {
+    TIMER_USER_NONE,    /* Resource is free */
+    TIMER_USER_APP,     /* Application code */
+    TIMER_USER_PWM,     /* \ref PWM_Init */
+    TIMER_USER_ICU,     /* Input capture engine (ICU.c) */
+    TIMER_USER_RTC,     /* Real time clock (TIMER_service.c) */
+    TIMER_USER_DELAY,   /* Busy wait delay (TIMER_service.c) */
+    TIMER_USER_ADC,     /* Paced ADC capture (ADC.c) */
+    TIMER_USER_CPU_LOAD,/* CPU load profiling (CPU_LOAD.c) */
+    TIMER_USER_SOFT_PWM,/* Software PWM (SOFT_PWM.c) */
+    NUM_OF_TIMER_USERS  /* At most 16: one bit per user in the allocator */
+}TIMER_USER_t;
+
 
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
@@ -205,12 +253,264 @@ void TIMER1_EnableCaptureInterrupt(void (* const callbackFunction)(void));
  ******************************************************************************/
 void TIMER1_DisableCaptureInterrupt(void);
 
+/*******************************************************************************
+ *  @brief          Configure the Input Capture Unit of Timer 1 (ICP1 pin)
+ *  @param[in]  edge: edge of ICP1 that triggers the capture
+ *  @param[in]  noiseCanceler: enable or disable the noise canceler
+ ******************************************************************************/
+void TIMER1_ConfigCapture(const TIMER_CAPTURE_EDGE_t edge, 
+                          const TIMER_NOISE_CANCELER_t noiseCanceler);
+
+/*******************************************************************************
+ *  @brief          Change the capture edge of Timer 1 only (ICES1)
+ *  @param[in]  edge: edge of ICP1 that triggers the next capture
+ *  @note       Cheap enough to be called from the capture ISR to toggle edges
+ ******************************************************************************/
+void TIMER1_SetCaptureEdge(const TIMER_CAPTURE_EDGE_t edge);
+
+/*******************************************************************************
+ *  @brief          Get the last captured value of Timer 1 (ICR1)
+ ******************************************************************************/
+u16_t TIMER1_GetCaptureValue(void);
+
 /*******************************************************************************
  *  @brief          Get Timer 2 Value (TCNT2)
  ******************************************************************************/
 u16_t TIMER1_GetTimerValue(void);
 
 
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                      Prototypes of Timer 2 functions                         */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+#define TIMER2_GetTop()    (255U)
+
+/*******************************************************************************
+ *  @brief          Initialize Timer 2
+ *  @param[in]  initValue: initial value of the timer
+ *  @param[in]  clock: clock source of the timer. F_CPU_32 and F_CPU_128 are
+ *              not available, external clock is on T2 pin.
+ *  @param[in]  timerMode: mode of the timer
+ *  @param[in]  compareMode: compare mode of the timer
+ ******************************************************************************/
+void TIMER2_Init(const u8_t initValue, const TIMER_CLOCK_t clock, 
+                 const TIMER_MODE_t timerMode, const TIMER_OC_t compareMode);
+
+/*******************************************************************************
+ *  @brief          Stop Timer 2 and disconnect OC2
+ ******************************************************************************/
+void TIMER2_Disable(void);
+
+/*******************************************************************************
+ *  @brief          Set Compare Value of Timer 2 (OCR2)
+ *  @param[in]  compareValue: compare value of the timer
+ ******************************************************************************/
+void TIMER2_SetCompareValue(const u8_t compareValue);
+
+/*******************************************************************************
+ *  @brief          Set Value of Timer 2 (TCNT2)
+ *  @param[in]  timerValue: value of the timer
+ ******************************************************************************/
+void TIMER2_SetTimer(const u8_t timerValue);
+
+/*******************************************************************************
+ *  @brief          Enable Overflow Interrupt of Timer 2
+ *  @param[in]  callbackFunction: callback function to be called when the timer 
+ *              overflows
+ ******************************************************************************/
+void TIMER2_EnableOverflowInterrupt(void (* const callbackFunction)(void));
+
+/*******************************************************************************
+ *  @brief          Disable Overflow Interrupt of Timer 2
+ ******************************************************************************/
+void TIMER2_DisableOverflowInterrupt(void);
+
+/*******************************************************************************
+ *  @brief          Enable Compare Match Interrupt of Timer 2
+ *  @param[in]  callbackFunction: callback function to be called when the timer 
+ *              matches the compare value
+ ******************************************************************************/
+void TIMER2_EnableCompareMatchInterrupt(void (* const callbackFunction)(void));
+
+/*******************************************************************************
+ *  @brief          Disable Compare Match Interrupt of Timer 2
+ ******************************************************************************/
+void TIMER2_DisableCompareMatchInterrupt(void);
+
+/*******************************************************************************
+ *  @brief          Get Timer 2 Value (TCNT2)
+ ******************************************************************************/
+u8_t TIMER2_GetTimerValue(void);
+
+/*******************************************************************************
+ *  @brief          Check if the overflow flag of Timer 2 (TOV2) is set
+ *  @note           Used with interrupts disabled to extend TCNT2 by a software
+ *                  overflow counter: the overflow ISR did not run yet.
+ ******************************************************************************/
+BOOL_t TIMER2_IsOverflowPending(void);
+
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                      Prototypes of Timer 3 functions                         */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+#define TIMER3_GetTop()    (65535U)
+
+/*******************************************************************************
+ *  @brief          Initialize Timer 3
+ *  @param[in]  initValue: initial value of the timer
+ *  @param[in]  clock: clock source of the timer
+ *  @param[in]  timerMode: mode of the timer
+ *  @param[in]  compareMode: compare mode of the timer
+ *  @param[in]  OCx: output compare of the timer (TIMER_OCA, TIMER_OCB, TIMER_OCC)
+ ******************************************************************************/
+void TIMER3_Init(const u16_t initValue, const TIMER_CLOCK_t clock, 
+                 const TIMER_MODE_t timerMode, const TIMER_OC_t compareMode, 
+                 const TIMER_OCx_t OCx);
+
+/*******************************************************************************
+ *  @brief          Set Value of Timer 3 (TCNT3)
+ *  @param[in]  timerValue: timer value
+ ******************************************************************************/
+void TIMER3_SetTimer(const u16_t timerValue);
+
+/*******************************************************************************
+ *  @brief          Enable Overflow Interrupt of Timer 3
+ *  @param[in]  callbackFunction: callback function to be called when the timer 
+ *              overflows
+ ******************************************************************************/
+void TIMER3_EnableOverflowInterrupt(void (* const callbackFunction)(void));
+
+/*******************************************************************************
+ *  @brief          Disable Overflow Interrupt of Timer 3
+ ******************************************************************************/
+void TIMER3_DisableOverflowInterrupt(void);
+
+/*******************************************************************************
+ *  @brief          Enable Capture Interrupt of Timer 3
+ *  @param[in]  callbackFunction: callback function to be called when the timer
+ *              captures an edge on ICP3
+ ******************************************************************************/
+void TIMER3_EnableCaptureInterrupt(void (* const callbackFunction)(void));
+
+/*******************************************************************************
+ *  @brief          Disable Capture Interrupt of Timer 3
+ ******************************************************************************/
+void TIMER3_DisableCaptureInterrupt(void);
+
+/*******************************************************************************
+ *  @brief          Configure the Input Capture Unit of Timer 3 (ICP3 pin)
+ *  @param[in]  edge: edge of ICP3 that triggers the capture
+ *  @param[in]  noiseCanceler: enable or disable the noise canceler
+ ******************************************************************************/
+void TIMER3_ConfigCapture(const TIMER_CAPTURE_EDGE_t edge, 
+                          const TIMER_NOISE_CANCELER_t noiseCanceler);
+
+/*******************************************************************************
+ *  @brief          Change the capture edge of Timer 3 only (ICES3)
+ *  @param[in]  edge: edge of ICP3 that triggers the next capture
+ ******************************************************************************/
+void TIMER3_SetCaptureEdge(const TIMER_CAPTURE_EDGE_t edge);
+
+/*******************************************************************************
+ *  @brief          Get the last captured value of Timer 3 (ICR3)
+ ******************************************************************************/
+u16_t TIMER3_GetCaptureValue(void);
+
+/*******************************************************************************
+ *  @brief          Get Timer 3 Value (TCNT3)
+ ******************************************************************************/
+u16_t TIMER3_GetTimerValue(void);
+
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                   Handlers bound at link time (ISRs)                         */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief   Called by the ISRs instead of the callbacks when
+ *          TIMER_HANDLERS_BINDING is BINDING_STATIC (see TIMER_cfg.h).
+ *          They are weak and empty in TIMER.c, so define only the ones you need:
+ * @par     Example:
+ *          @code
+ *          void TIMER0_OVF_Handler(void) {
+ *              ++ticks;
+ *          }
+ *          @endcode
+ ******************************************************************************/
+void TIMER0_COMP_Handler(void);
+void TIMER0_OVF_Handler(void);
+void TIMER1_CAPT_Handler(void);
+void TIMER1_COMPA_Handler(void);
+void TIMER1_COMPB_Handler(void);
+void TIMER1_COMPC_Handler(void);
+void TIMER1_OVF_Handler(void);
+void TIMER2_COMP_Handler(void);
+void TIMER2_OVF_Handler(void);
+void TIMER3_CAPT_Handler(void);
+void TIMER3_COMPA_Handler(void);
+void TIMER3_COMPB_Handler(void);
+void TIMER3_COMPC_Handler(void);
+void TIMER3_OVF_Handler(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                  Prototypes of timers allocation functions                   */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief       Reserve resources of a timer before configuring it.
+ * @param[in]   timer: The timer. See \ref TIMER_t.
+ * @param[in]   resources: OR of \ref TIMER_RESOURCE_t members.
+ * @param[in]   user: The module that reserves. See \ref TIMER_USER_t.
+ * @param[in]   clock: The clock needed by the user, if TIMER_RES_COUNTER is
+ *              reserved.
+ * @param[in]   timerMode: The mode needed by the user, if TIMER_RES_COUNTER is
+ *              reserved.
+ * @return      ERROR_t: - ERROR_OK if all resources are reserved.
+ *                       - ERROR_BUSY if a resource is owned by another user,
+ *                         or the counter is used with another clock or mode.
+ *                       - ERROR_ILLEGAL_PARAM if the timer does not have the
+ *                         resource or does not support the clock.
+ * @note        Nothing is reserved if any resource is not available.
+ *              Reserving a resource twice by the same user is allowed.
+ ******************************************************************************/
+ERROR_t TIMER_Reserve(const TIMER_t timer, const u8_t resources, const TIMER_USER_t user,
+                      const TIMER_CLOCK_t clock, const TIMER_MODE_t timerMode);
+
+/*******************************************************************************
+ * @brief       Release resources of a timer reserved by \ref TIMER_Reserve.
+ * @param[in]   timer: The timer. See \ref TIMER_t.
+ * @param[in]   resources: OR of \ref TIMER_RESOURCE_t members.
+ * @param[in]   user: The module that reserved the resources.
+ * @return      ERROR_t: ERROR_BUSY if a resource is owned by another user.
+ * @note        The counter is free when all its users release it.
+ ******************************************************************************/
+ERROR_t TIMER_Release(const TIMER_t timer, const u8_t resources, const TIMER_USER_t user);
+
+/*******************************************************************************
+ * @brief       Get the owner of a resource of a timer
+ * @param[in]   timer: The timer. See \ref TIMER_t.
+ * @param[in]   resource: One member of \ref TIMER_RESOURCE_t except
+ *              TIMER_RES_COUNTER (shared resource).
+ * @return      TIMER_USER_t: TIMER_USER_NONE if the resource is free.
+ ******************************************************************************/
+TIMER_USER_t TIMER_GetOwner(const TIMER_t timer, const TIMER_RESOURCE_t resource);
+
+/*******************************************************************************
+ * @brief       Get the number of users sharing the counter of a timer
+ * @param[in]   timer: The timer. See \ref TIMER_t.
+ * @return      u8_t: 0 if the counter is free: its clock can be stopped.
+ ******************************************************************************/
+u8_t TIMER_GetCounterUsers(const TIMER_t timer);
+
 /*------------------------------------------------------------------------------*/
 /*                      Prototypes of PWMs functions                            */
 /*------------------------------------------------------------------------------*/
@@ -220,8 +520,11 @@ u16_t TIMER1_GetTimerValue(void);
  *  @param[in]  channel: PWM channel, can be one of the following:
  *              \ref PWM_0 to \ref PWM_7. Members of \ref PWM_t enumeration
  * @param[in]   frequencyInKHz: frequency of the PWM signal
+ * @return      ERROR_t: ERROR_BUSY if the timer of the channel is used by
+ *              another module with another configuration (see
+ *              \ref TIMER_Reserve). The timer is not changed in this case.
  ******************************************************************************/
-void PWM_Init(const PWM_t channel, const u32_t frequencyInKHz);
+ERROR_t PWM_Init(const PWM_t channel, const u32_t frequencyInKHz);
 
 /*******************************************************************************
  *  @brief          Set Duty Cycle of PWM
@@ -0,0 +1,37 @@
+/******************************************************************************
+ * @file        TIMER_cfg.h
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Configuration header file for \ref TIMER.c
+ * @version     1.0.0
+ * @date        2022-07-20
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#ifndef TIMER_CFG_H
+#define TIMER_CFG_H
+
+#include "BINDING.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief How the timer ISRs call the application code (see BINDING.h).
+ *        Options are:
+ *          BINDING_RUNTIME --> the callbacks passed to TIMERn_Enable...Interrupt()
+ *          BINDING_STATIC  --> TIMERn_xxx_Handler() functions (see TIMER.h)
+ * @warning ICU, SOFT_PWM, CPU_LOAD, the RTC and the capture of ADC register
+ *          callbacks: their build fails with BINDING_STATIC.
+ *****************************************************************************/
+#define TIMER_HANDLERS_BINDING      BINDING_RUNTIME
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif    /* TIMER_CFG_H */
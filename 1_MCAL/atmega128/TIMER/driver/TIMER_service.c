@@ -8,119 +8,64 @@
  ***************************************************************************/
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
+#include "TIMER_reg.h"
+#include "GIE.h"
 #include "TIMER.h"
+#include "TIMER_cfg.h"
 #include "TIMER_service.h"
 
+/*!< TIMER0 ticks of one millisecond in CTC mode with F_CPU_64 */
+#define DELAY_TICKS_PER_MS      (F_CPU / 64UL / 1000UL)
+
+#if (DELAY_TICKS_PER_MS == 0) || (DELAY_TICKS_PER_MS > 256)
+#error "TTIMER_delayMs: F_CPU is not supported with TIMER0 and F_CPU_64"
+#endif
+
+#if (TIMER_HANDLERS_BINDING == BINDING_STATIC)
+#error "TIMER_RtcInit: the timer callbacks are ignored with BINDING_STATIC, set TIMER_HANDLERS_BINDING to BINDING_RUNTIME"
+#endif
+
 /****************************************************************************
- * Function: TTIMER_delay()
- /**
- * Description: used for delay to wait and make processor busy
- *				 the maximum period depend on prescaler that used
- *				            -prescaler 8    -----> max time 256        micro second
- *				            -prescaler 64   -----> max time 2_048       micro second
- *				            -prescaler 256  -----> max time 8_192       micro second
- *                         -prescaler 1024 -----> max time 32_768     micro second
- *                         desired period calculation depend on that
- *
- * PRECONDTION: TIMER CLK SOURCE IS CLOCK
+ * Function: TTIMER_delayMs()
+ * Description: used for delay to wait and make processor busy.
+ *              TIMER0 is reserved in CTC mode during the delay, so the delay
+ *              fails instead of breaking another module that uses TIMER0
+ *              (the RTC or PWM_0 for example).
  *
- * @param[IN]  period
+ * @param[IN]  u64Period: the delay in milliseconds
  *
- * @return Error error
+ * @return Error error: ERROR_BUSY if TIMER0 is used by another module
  ******************************************************************************/
+ERROR_t TTIMER_delayMs(const u64_t u64Period) {
+    ERROR_t error = ERROR_OK;
+    u64_t remaining = u64Period;
 
-ERROR_t TTIMER_delayMs(const u64_t u64Period){
-
-	ERROR_t error = DONE;
-	u32_t TickTime,OverFlowTicks,Freq,Prescaler,DesiredTicks;
-	u8_t Flag,Preload;
-	f32_t NO_ofOverflow;
-
-	/*
-	 * define the freq ,presacler, OverFlowTicks parameters
-	 */
-	Freq = SYS_CLK;
-	Prescaler = TIMER_CLK_SRC ;
-	OverFlowTicks= TIMER_TICKS;
-	/*
-	 * calculate the Tick time of counter in microsecond
-	 */
-	TickTime = Prescaler / Freq;
-
-	/*
-	 * calculate the desired ticks
-	 */
-
-	DesiredTicks = Period / TickTime;
-
-	/**
-	 * Check the relation between overflow ticks and desired ticks
-	 */
-	if(DesiredTicks > OverFlowTicks){
-
-		NO_ofOverflow = (f32_t)DesiredTicks /OverFlowTicks;
-		/*to get integer part */
-		Flag = (u32_t)NO_ofOverflow;
-		/*to get fraction part and calculate the preload value*/
-		Preload = ((1-(NO_ofOverflow -Flag))*OverFlowTicks);
-		if(Preload >0 ){
-			Flag ++;
-		}
-		TCNT0 = Preload;
-
-		/*Stuck until during is elapsed */
-
-		while(Flag > 0)
-		{
-			/*Decrement flag each time */
-			Flag --;
-			/*stay polling until flag is raised */
-			while(BIT_READ(TIFR,TIFR_TOV0) != 1);
-			/*CLEAR FLAG BY ST WITH LOGIC ONE*/
-			BIT_SET(TIFR,TIFR_TOV0);
-
-		}
-
-
-		error = STAT1;
-
-
-	}
-	else if(DesiredTicks < OverFlowTicks){
-		/*
-		 * we calculate the preload value and set to timer register
-		 */
-		Preload = OverFlowTicks -DesiredTicks;
-		TCNT0 = Preload;
-		/*stay polling until flag is raised */
-		while(BIT_READ(TIFR,TIFR_TOV0) != 1);
-		/*CLEAR FLAG BY ST WITH LOGIC ONE*/
-		BIT_SET(TIFR,TIFR_TOV0);
-		error = STAT2;
-	}
-	else if(DesiredTicks == OverFlowTicks){
-		TCNT0 = 0;
-
-		/*stay polling until flag is raised */
-		while(BIT_READ(TIFR,TIFR_TOV0) != 1);
-		/*CLEAR FLAG BY ST WITH LOGIC ONE*/
-		BIT_SET(TIFR,TIFR_TOV0);
-		error = STAT3;
-	}
-
-	else
-	{
-		error = NULLPTR;
-	}
+    error |= TIMER_Reserve(TIMER_0, TIMER_RES_COUNTER | TIMER_RES_OCA, TIMER_USER_DELAY, 
+                           F_CPU_64, TIMER_MODE_CTC);
 
-	return error;
+    if(ERROR_OK == error) {
+        TIMER0_SetCompareValue((u8_t)(DELAY_TICKS_PER_MS - 1));
+        TIMER0_Init(0, F_CPU_64, TIMER_MODE_CTC, NO_OC);
+        TIMER_u8_tTIFR_REG = (1 << OCF0);
 
+        while(remaining > 0) {
+            /*stay polling until flag is raised */
+            while( BIT_IS_CLEAR(TIMER_u8_tTIFR_REG, OCF0) );
+            /*CLEAR FLAG BY WRITING LOGIC ONE*/
+            TIMER_u8_tTIFR_REG = (1 << OCF0);
+            --remaining;
+        }
 
+        TIMER0_Init(0, NO_CLOCK, TIMER_MODE_NORMAL, NO_OC);
+        error |= TIMER_Release(TIMER_0, TIMER_RES_COUNTER | TIMER_RES_OCA, TIMER_USER_DELAY);
+    }
 
+    return error;
 }
 
 
 static char not_leap(void);
+static void TIMER_RtcTick(void);
 
 TIME_t time  = {0};
 
@@ -133,7 +78,34 @@ ERROR_t TIMER_getTime(TIME_t * const retTime) {
     return error;
 }
 
-ISR(TIMER0_OVF_vect)
+/****************************************************************************
+ * Function: TIMER_RtcInit()
+ * Description: TIMER0 is clocked from the 32.768 KHz crystal on TOSC1/TOSC2,
+ *              32768 / 128 / 256 = 1 overflow per second.
+ ******************************************************************************/
+ERROR_t TIMER_RtcInit(void) {
+    ERROR_t error = ERROR_OK;
+
+    error |= TIMER_Reserve(TIMER_0, TIMER_RES_COUNTER | TIMER_RES_OVERFLOW, TIMER_USER_RTC, 
+                           F_CPU_128, TIMER_MODE_NORMAL);
+
+    if(ERROR_OK == error) {
+        BIT_SET(ASSR, AS0);
+        TIMER0_Init(0, F_CPU_128, TIMER_MODE_NORMAL, NO_OC);
+
+        /* wait until the registers are updated in the asynchronous domain */
+        while( BIT_IS_SET(ASSR, TCN0UB) || BIT_IS_SET(ASSR, TCR0UB) );
+
+        TIMER_u8_tTIFR_REG = (1 << TOV0);
+        TIMER0_EnableOverflowInterrupt(TIMER_RtcTick);
+        GIE_Enable();
+    }
+
+    return error;
+}
+
+/* called every second from the overflow ISR of TIMER0 */
+static void TIMER_RtcTick(void)
 {
 	if(++time.second == 60) {
 		time.second = 0;
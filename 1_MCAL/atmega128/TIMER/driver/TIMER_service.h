@@ -31,8 +31,20 @@ extern TIME_t time;
 /*                                                                              */
 /*------------------------------------------------------------------------------*/
 
+/*******************************************************************************
+ * @brief       Busy wait using TIMER0
+ * @param[in]   periodInMs: The delay in milliseconds
+ * @return      ERROR_t: ERROR_BUSY if TIMER0 is reserved by another module
+ ******************************************************************************/
 ERROR_t TTIMER_delayMs(const u64_t periodInMs);
 
+/*******************************************************************************
+ * @brief       Start the real time clock on TIMER0 (32.768 KHz crystal)
+ * @return      ERROR_t: ERROR_BUSY if TIMER0 is reserved by another module
+ * @note        Global interrupts are enabled by this function.
+ ******************************************************************************/
+ERROR_t TIMER_RtcInit(void);
+
 ERROR_t TIMER_getTime(TIME_t * const time);
 
 
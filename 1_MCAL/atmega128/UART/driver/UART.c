@@ -705,15 +705,31 @@ static void UART_Flush(volatile u8_t *UCSRnA, ERROR_t (* const UART_ReceiveByte)
 /*----------------------------------------------------------------------*/
 /*                          ISR FUNCTIONS                               */
 /*----------------------------------------------------------------------*/
+#if (UART_HANDLERS_BINDING == BINDING_STATIC)
+/* Handlers are bound at link time: the application overrides the weak ones */
+#define UART_DISPATCH(NAME)     NAME##_Handler()
+
+static void UART_DefaultHandler(void) {
+    /* Interrupt enabled without a handler: nothing to do */
+}
+
+void UART0_RX_Handler(void) __attribute__((weak, alias("UART_DefaultHandler")));
+void UART0_TX_Handler(void) __attribute__((weak, alias("UART_DefaultHandler")));
+void UART0_UDRE_Handler(void) __attribute__((weak, alias("UART_DefaultHandler")));
+void UART1_RX_Handler(void) __attribute__((weak, alias("UART_DefaultHandler")));
+void UART1_TX_Handler(void) __attribute__((weak, alias("UART_DefaultHandler")));
+void UART1_UDRE_Handler(void) __attribute__((weak, alias("UART_DefaultHandler")));
+#else
+#define UART_DISPATCH(NAME)     do { if(NULL != NAME##_Callback) { NAME##_Callback(); } } while(0)
+#endif
+
 /* UART0_RX_ISR */
 void __vector_18(void) __attribute__((signal));
 void __vector_18(void) {
 
     GIE_Disable();
 
-    if(NULL != UART0_RX_Callback) {
-        UART0_RX_Callback();
-    }
+    UART_DISPATCH(UART0_RX);
 
     /* Clear the RXC flag */
     BIT_SET(UCSR0A, RXC);
@@ -726,9 +742,7 @@ void __vector_20(void) __attribute__((signal));
 void __vector_20(void) {
     GIE_Disable();
 
-    if(UART0_TX_Callback != NULL) {
-        UART0_TX_Callback();
-    }
+    UART_DISPATCH(UART0_TX);
 
     /* Clear the TXC flag */
     BIT_SET(UCSR0A, TXC);
@@ -741,9 +755,7 @@ void __vector_19(void) __attribute__((signal));
 void __vector_19(void) {
     GIE_Disable();
 
-    if(UART0_UDRE_Callback != NULL) {
-        UART0_UDRE_Callback();
-    }
+    UART_DISPATCH(UART0_UDRE);
 
     /* Clear the UDRE flag */
     BIT_CLR(UCSR0A, UDRE);
@@ -756,9 +768,7 @@ void __vector_30(void) __attribute__((signal));
 void __vector_30(void) {
     GIE_Disable();
 
-    if(NULL != UART1_RX_Callback) {
-        UART1_RX_Callback();
-    }
+    UART_DISPATCH(UART1_RX);
 
     /* Clear the RXC flag */
     BIT_SET(UCSR1A, RXC);
@@ -771,9 +781,7 @@ void __vector_32(void) __attribute__((signal));
 void __vector_32(void) {
     GIE_Disable();
 
-    if(UART1_TX_Callback != NULL) {
-        UART1_TX_Callback();
-    }
+    UART_DISPATCH(UART1_TX);
 
     /* Clear the TXC flag */
     BIT_SET(UCSR1A, TXC);
@@ -786,9 +794,7 @@ void __vector_31(void) __attribute__((signal));
 void __vector_31(void) {
     GIE_Disable();
 
-    if(UART1_UDRE_Callback != NULL) {
-        UART1_UDRE_Callback();
-    }
+    UART_DISPATCH(UART1_UDRE);
 
     /* Clear the UDRE flag */
     BIT_CLR(UCSR1A, UDRE);
@@ -271,4 +271,16 @@ void UART0_UDRE_InterruptDisable(void);
 void UART1_UDRE_InterruptDisable(void);
 
 
+/******************************************************************************
+ * @brief   Called by the ISRs instead of the callbacks when
+ *          UART_HANDLERS_BINDING is BINDING_STATIC (see UART_cfg.h). They are
+ *          weak and empty in UART.c, so define only the ones you need.
+ *****************************************************************************/
+void UART0_RX_Handler(void);
+void UART0_TX_Handler(void);
+void UART0_UDRE_Handler(void);
+void UART1_RX_Handler(void);
+void UART1_TX_Handler(void);
+void UART1_UDRE_Handler(void);
+
 #endif                  
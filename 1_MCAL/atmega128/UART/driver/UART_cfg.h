@@ -9,8 +9,20 @@
 #ifndef UART_CFG_H
 #define UART_CFG_H
 
+#include "BINDING.h"
+
 #define UART_TIMEOUT_CYCLE_COUNT  (16000)
 
+/******************************************************************************
+ * @brief Binding of the RX, TX and UDRE ISRs of UART0 and UART1 to the
+ *        application (see BINDING.h).
+ *        Options are:
+ *          BINDING_RUNTIME --> the callbacks of UARTn_xxx_InterruptEnable()
+ *          BINDING_STATIC  --> UARTn_RX/TX/UDRE_Handler() (see UART.h)
+ *****************************************************************************/
+#define UART_HANDLERS_BINDING      BINDING_RUNTIME
+
+
 /*----------------------------------------------------------------------------*/
 /*                                                                            */
 /*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
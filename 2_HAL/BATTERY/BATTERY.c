@@ -6,11 +6,7 @@
  * @date        2022-02-08
  * @copyright   Copyright (c) 2022
  **************************************************************************/
-
-#if 0   /* Until im[plementing ADC */
-
 #include "STD_TYPES.h"
-#include "DIO.h"
 #include "ADC.h"
 #include "BATTERY.h"
 #include "BATTERY_cfg.h"
@@ -18,33 +14,58 @@
 /**************************************************************************
  * @brief  Initialize the Battery Management Module
  *************************************************************************/
-void BATTERY_Init() {
+void BATTERY_Init(void) {
     /* Initialize the Battery Management Module */
 }
 
+/**************************************************************************
+ * @brief Get the voltage of the battery, before the voltage divider.
+ * @param[out] ptrToMillivolts: The voltage of the battery in mV.
+ *************************************************************************/
+ERROR_t BATTERY_GetMillivolts(u16_t * const ptrToMillivolts) {
+    ERROR_t error = ERROR_OK;
+    u16_t pinMillivolts = 0;
+
+    if(NULL == ptrToMillivolts) {
+        return ERROR_NULL_POINTER;
+    }
+
+    error |= ADC_ReadMillivolts(BatteryConfigs.channel, &pinMillivolts);
+
+    if(ERROR_OK == error) {
+        *ptrToMillivolts = (u16_t)( ((u32_t)pinMillivolts * BATTERY_VOLTAGE_DIVIDER_NUMERATOR) /
+                                    BATTERY_VOLTAGE_DIVIDER_DENOMINATOR );
+    }
+
+    return error;
+}
+
 /**************************************************************************
  * @brief Get the state of the battery
- * @return STATE_t HIGH if the battery is full, LOW if the battery is empty, 
- *         NORMAL if the battery is in between the two thresholds
+ * @param[out] ptrToState: HIGH if the battery is full, LOW if the battery 
+ *             is empty, NORMAL if the battery is in between the two thresholds
  *************************************************************************/
-STATE_t BATTERY_GetState() {
-    f32_t batteryVoltage = 0.0f;
-    STATE_t state = HIGH;
+ERROR_t BATTERY_GetState(STATE_t * const ptrToState) {
+    ERROR_t error = ERROR_OK;
+    u16_t batteryMillivolts = 0;
+
+    if(NULL == ptrToState) {
+        return ERROR_NULL_POINTER;
+    }
     
     /* Get the battery voltage */
-    batteryVoltage = ADC_ReadVoltage(BatteryConfigs.pin, BatteryConfigs.port);
-    batteryVoltage = batteryVoltage * BATTERY_VOLTAGE_DIVIDER_RATIO;
+    error |= BATTERY_GetMillivolts(&batteryMillivolts);
     
     /* Check the range of the battery */
-    if(batteryVoltage > BatteryConfigs.maxVoltage) {
-        state = HIGH;
-    }else if(batteryVoltage < BatteryConfigs.minVoltage) {
-        state = LOW;
-    }else {
-        state = NORMAL;
+    if(ERROR_OK == error) {
+        if(batteryMillivolts > BatteryConfigs.maxMillivolts) {
+            *ptrToState = HIGH;
+        }else if(batteryMillivolts < BatteryConfigs.minMillivolts) {
+            *ptrToState = LOW;
+        }else {
+            *ptrToState = NORMAL;
+        }
     }
 
-    return state;
+    return error;
 }
-
-#endif
\ No newline at end of file
@@ -11,7 +11,8 @@
 
 /* Prototypes */
 void    BATTERY_Init(void);
-STATE_t BATTERY_GetState(void);
+ERROR_t BATTERY_GetMillivolts(u16_t * const ptrToMillivolts);
+ERROR_t BATTERY_GetState(STATE_t * const ptrToState);
 
 
 #endif
\ No newline at end of file
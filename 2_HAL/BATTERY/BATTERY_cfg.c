@@ -7,7 +7,7 @@
  * @copyright   Copyright (c) 2022
  ******************************************************************************/
 #include "STD_TYPES.h"
-#include "DIO.h"
+#include "ADC.h"
 #include "BATTERY.h"
 #include "BATTERY_cfg.h"
 
@@ -19,8 +19,7 @@
  * @note    The configuration is done in the BATTERY_cfg.h and BATTERY_cfg.c files. 
  *************************************************************************/
 BatteryConfigs_t BatteryConfigs = {
-    .pin        = DIO_PIN_0, 
-    .port       = DIO_PORT_C, 
-    .minVoltage = 11.2f, 
-    .maxVoltage = 12.8f
+    .channel        = ADC_CHANNEL_BATTERY, 
+    .minMillivolts  = 11200U, 
+    .maxMillivolts  = 12800U
 };
\ No newline at end of file
@@ -9,20 +9,21 @@
 #ifndef BATTERY_CFG_H
 #define BATTERY_CFG_H
 
-#define BATTERY_CAPACITY        18.0f      /* 18 AH    */
-#define BATTERY_VOLTAGE         12.0f      /* 12 V     */
-#define BATTERY_FULL_VOLTAGE    12.0f      /* 12 V     */
-#define BATTERY_EMPTY_VOLTAGE   6.0f       /* 6 V      */
+#define BATTERY_CAPACITY_MAH            (18000U)    /* 18 AH    */
+#define BATTERY_MILLIVOLTS              (12000U)    /* 12 V     */
+#define BATTERY_FULL_MILLIVOLTS         (12000U)    /* 12 V     */
+#define BATTERY_EMPTY_MILLIVOLTS        (6000U)     /* 6 V      */
 
 /* if the battery voltage rating is higher than the logic voltage of the microcontroller, use 
-    a voltage divider to convert the battery voltage to the logic voltage */
-#define BATTERY_VOLTAGE_DIVIDER_RATIO    (12 / 4.0f)    /* 12V : 4V    */
+    a voltage divider to convert the battery voltage to the logic voltage.
+    Battery voltage = pin voltage * NUMERATOR / DENOMINATOR */
+#define BATTERY_VOLTAGE_DIVIDER_NUMERATOR       (12U)   /* 12V : 4V    */
+#define BATTERY_VOLTAGE_DIVIDER_DENOMINATOR     (4U)
 
 typedef struct{
-    DIO_PIN_t       pin;
-    DIO_PORT_t      port;
-    f32_t         minVoltage;
-    f32_t         maxVoltage;
+    ADC_CHANNEL_t   channel;            /* Configured in ADC_cfg.c */
+    u16_t           minMillivolts;
+    u16_t           maxMillivolts;
 }BatteryConfigs_t;
 
 extern BatteryConfigs_t BatteryConfigs;
@@ -0,0 +1,292 @@
+/**************************************************************************
+ * @file        CPU_LOAD.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       CPU load and idle time profiling service
+ * @details     TIMER2 runs freely and its overflows extend TCNT2 to a 32-bit
+ *              time base. The application marks its idle time by
+ *              \ref CPU_LOAD_IdleEnter / \ref CPU_LOAD_IdleExit (around a
+ *              sleep or a polling loop) and, optionally, its ISRs by
+ *              \ref CPU_LOAD_IsrEnter / \ref CPU_LOAD_IsrExit.
+ *              Every window (1 second by default) the overflow ISR publishes:
+ *              - The busy time: window - (idle - ISRs during idle).
+ *              - The longest busy interval between two idle periods.
+ *              - The time spent in each profiled ISR.
+ * @version     1.0.0
+ * @date        2022-07-16
+ * @copyright   Copyright (c) 2022
+ **************************************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "SREG.h"
+#include "GIE.h"
+#include "TIMER.h"
+#include "TIMER_cfg.h"
+#include "UART_service.h"
+#include "CPU_LOAD.h"
+#include "CPU_LOAD_cfg.h"
+
+#if (TIMER_HANDLERS_BINDING == BINDING_STATIC)
+#error "CPU_LOAD: the timer callbacks are ignored with BINDING_STATIC, set TIMER_HANDLERS_BINDING to BINDING_RUNTIME"
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                      PRIVATE FUNCTIONS PROTOTYPES                            */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static u32_t CPU_LOAD_GetTime(void);
+static void CPU_LOAD_CloseWindow(const u32_t now);
+static u16_t CPU_LOAD_Permille(u32_t part, u32_t whole);
+static void CPU_LOAD_SendPermille(const u16_t permille);
+static void CPU_LOAD_TimerOverflow(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE VARIABLES                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static volatile u32_t overflows = 0;        /*!< Upper 24 bits of the time base */
+static u32_t windowStart = 0;               /*!< Time of the start of the current window */
+static u32_t idleTicks = 0;                 /*!< Idle time in the current window */
+static u32_t idleStart = 0;
+static BOOL_t isIdle = FALSE;
+static u32_t busyStart = 0;                 /*!< End of the last idle period */
+static u32_t peakBusyTicks = 0;             /*!< Longest busy interval in the current window */
+static u32_t isrStart[NUM_OF_CPU_LOAD_ISRS];
+static u32_t isrTicks[NUM_OF_CPU_LOAD_ISRS];
+static u32_t isrTicksInIdle = 0;            /*!< ISRs time that interrupted idle periods */
+static CPU_LOAD_REPORT_t report;            /*!< Measurements of the last completed window */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PUBLIC FUNCTIONS                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+ERROR_t CPU_LOAD_Init(void) {
+    ERROR_t error = ERROR_OK;
+    u8_t i = 0;
+
+    error |= TIMER_Reserve(TIMER_2, TIMER_RES_COUNTER | TIMER_RES_OVERFLOW, TIMER_USER_CPU_LOAD,
+                           CPU_LOAD_TIMER_CLOCK, TIMER_MODE_NORMAL);
+
+    if(ERROR_OK == error) {
+        GIE_Disable();
+
+        overflows       = 0;
+        windowStart     = 0;
+        idleTicks       = 0;
+        isIdle          = FALSE;
+        busyStart       = 0;
+        peakBusyTicks   = 0;
+        isrTicksInIdle  = 0;
+        report.windows  = 0;
+        for(i = 0; i < NUM_OF_CPU_LOAD_ISRS; ++i) {
+            isrTicks[i] = 0;
+        }
+
+        TIMER2_Init(0, CPU_LOAD_TIMER_CLOCK, TIMER_MODE_NORMAL, NO_OC);
+        TIMER2_EnableOverflowInterrupt(CPU_LOAD_TimerOverflow);   /*!< Enables GIE */
+    }
+
+    return error;
+}
+
+void CPU_LOAD_IdleEnter(void) {
+    u32_t now = 0;
+    const u8_t u8_tSreg = SREG;
+
+    GIE_Disable();
+
+    now = CPU_LOAD_GetTime();
+
+    if(FALSE == isIdle) {
+        if( (now - busyStart) > peakBusyTicks ) {
+            peakBusyTicks = now - busyStart;
+        }
+        idleStart = now;
+        isIdle = TRUE;
+    }
+
+    SREG = u8_tSreg;
+}
+
+void CPU_LOAD_IdleExit(void) {
+    u32_t now = 0;
+    const u8_t u8_tSreg = SREG;
+
+    GIE_Disable();
+
+    now = CPU_LOAD_GetTime();
+
+    if(TRUE == isIdle) {
+        idleTicks += now - idleStart;
+        busyStart = now;
+        isIdle = FALSE;
+    }
+
+    SREG = u8_tSreg;
+}
+
+void CPU_LOAD_IsrEnter(const CPU_LOAD_ISR_t isr) {
+    const u8_t u8_tSreg = SREG;
+
+    if(isr < NUM_OF_CPU_LOAD_ISRS) {
+        GIE_Disable();
+        isrStart[isr] = CPU_LOAD_GetTime();
+        SREG = u8_tSreg;
+    }
+}
+
+void CPU_LOAD_IsrExit(const CPU_LOAD_ISR_t isr) {
+    u32_t duration = 0;
+    const u8_t u8_tSreg = SREG;
+
+    if(isr < NUM_OF_CPU_LOAD_ISRS) {
+        GIE_Disable();
+
+        duration = CPU_LOAD_GetTime() - isrStart[isr];
+        isrTicks[isr] += duration;
+        if(TRUE == isIdle) {
+            isrTicksInIdle += duration;
+        }
+
+        SREG = u8_tSreg;
+    }
+}
+
+ERROR_t CPU_LOAD_GetReport(CPU_LOAD_REPORT_t * const ptrToReport) {
+    ERROR_t error = ERROR_OK;
+    const u8_t u8_tSreg = SREG;
+
+    if(NULL == ptrToReport) {
+        return ERROR_NULL_POINTER;
+    }
+
+    GIE_Disable();
+    *ptrToReport = report;
+    SREG = u8_tSreg;
+
+    if(0 == ptrToReport->windows) {
+        error |= ERROR_BUSY;
+    }
+
+    return error;
+}
+
+ERROR_t CPU_LOAD_SendReport(void) {
+    ERROR_t error = ERROR_OK;
+    CPU_LOAD_REPORT_t lastReport;
+    u8_t i = 0;
+
+    error |= CPU_LOAD_GetReport(&lastReport);
+
+    if(ERROR_OK == error) {
+        CPU_LOAD_SendString((const u8_t *)"LOAD ");
+        CPU_LOAD_SendPermille(lastReport.loadPermille);
+        CPU_LOAD_SendString((const u8_t *)"% PEAK ");
+        CPU_LOAD_SendInteger((s32_t)lastReport.peakBusyUs);
+        CPU_LOAD_SendString((const u8_t *)"us ISR");
+        for(i = 0; i < NUM_OF_CPU_LOAD_ISRS; ++i) {
+            CPU_LOAD_SendString((const u8_t *)" ");
+            CPU_LOAD_SendPermille(lastReport.isrPermille[i]);
+            CPU_LOAD_SendString((const u8_t *)"%");
+        }
+        CPU_LOAD_SendString((const u8_t *)"\r\n");
+    }
+
+    return error;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE FUNCTIONS                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**************************************************************************
+ * @brief  Get the time in timer ticks.
+ * @note   Must be called with interrupts disabled: a pending overflow with a
+ *         small TCNT2 means that the overflow ISR did not count it yet.
+ *************************************************************************/
+static u32_t CPU_LOAD_GetTime(void) {
+    u32_t upper = overflows;
+    const u8_t counter = TIMER2_GetTimerValue();
+
+    if( (TRUE == TIMER2_IsOverflowPending()) && (counter < 128) ) {
+        ++upper;
+    }
+
+    return (upper << 8) | counter;
+}
+
+/**************************************************************************
+ * @brief  Publish the measurements of the current window and start a new one.
+ * @param[in] now: Time of the end of the window.
+ *************************************************************************/
+static void CPU_LOAD_CloseWindow(const u32_t now) {
+    const u32_t windowTicks = now - windowStart;
+    u32_t idle = 0;
+    u8_t i = 0;
+
+    /*!< The current idle or busy period continues in the next window */
+    if(TRUE == isIdle) {
+        idleTicks += now - idleStart;
+        idleStart = now;
+    } else if( (now - busyStart) > peakBusyTicks ) {
+        peakBusyTicks = now - busyStart;
+    } else {
+        /* Nothing to do */
+    }
+
+    idle = (idleTicks > isrTicksInIdle) ? (idleTicks - isrTicksInIdle) : 0;
+    if(idle > windowTicks) {
+        idle = windowTicks;
+    }
+
+    report.loadPermille = CPU_LOAD_Permille(windowTicks - idle, windowTicks);
+    report.peakBusyUs   = (peakBusyTicks * CPU_LOAD_TIMER_PRESCALER) / (F_CPU / 1000000UL);
+    for(i = 0; i < NUM_OF_CPU_LOAD_ISRS; ++i) {
+        report.isrPermille[i] = CPU_LOAD_Permille(isrTicks[i], windowTicks);
+        isrTicks[i] = 0;
+    }
+    ++report.windows;
+
+    windowStart     = now;
+    idleTicks       = 0;
+    isrTicksInIdle  = 0;
+    peakBusyTicks   = 0;
+}
+
+static u16_t CPU_LOAD_Permille(u32_t part, u32_t whole) {
+    /*!< Scale down, so that part * 1000 fits in 32 bits */
+    while(whole > 0x003FFFFFUL) {
+        part  >>= 1;
+        whole >>= 1;
+    }
+
+    return (whole > 0) ? (u16_t)( (part * 1000UL) / whole ) : 0;
+}
+
+static void CPU_LOAD_SendPermille(const u16_t permille) {
+    CPU_LOAD_SendInteger(permille / 10);
+    CPU_LOAD_SendString((const u8_t *)".");
+    CPU_LOAD_SendInteger(permille % 10);
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          CALLBACKS OF TIMER ISRs                             */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+static void CPU_LOAD_TimerOverflow(void) {
+    u32_t now = 0;
+
+    ++overflows;
+    now = overflows << 8;
+
+    if( (now - windowStart) >= CPU_LOAD_WINDOW_TICKS ) {
+        CPU_LOAD_CloseWindow(now);
+    }
+}
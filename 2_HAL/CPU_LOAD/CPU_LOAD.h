@@ -0,0 +1,102 @@
+/******************************************************************************
+ * @file            CPU_LOAD.h
+ * @author          Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief           Interfaces header file for \ref CPU_LOAD.c
+ * @version         1.0.0
+ * @date            2022-07-16
+ * PRECONDITIONS:   - TIMER.c and UART_service.c must be included in the project
+ *                  - TIMER2 is reserved by this module (see \ref TIMER_Reserve)
+ * @copyright       Copyright (c) 2022
+ ******************************************************************************/
+#ifndef CPU_LOAD_H
+#define CPU_LOAD_H
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   ISRs that can be profiled by \ref CPU_LOAD_IsrEnter and
+ *          \ref CPU_LOAD_IsrExit. Change it to your needs.
+ ******************************************************************************/
+typedef enum {
+    CPU_LOAD_ISR_ADC,
+    CPU_LOAD_ISR_UART0,
+    CPU_LOAD_ISR_TIMER,
+    NUM_OF_CPU_LOAD_ISRS
+} CPU_LOAD_ISR_t;
+
+/******************************************************************************
+ * @brief   Measurements of the last completed window (1 second by default).
+ ******************************************************************************/
+typedef struct {
+    u16_t   loadPermille;                           /*!< Busy time in 0.1 % */
+    u32_t   peakBusyUs;                             /*!< Longest time between two idle periods in us */
+    u16_t   isrPermille[NUM_OF_CPU_LOAD_ISRS];      /*!< Time spent in each ISR in 0.1 % */
+    u32_t   windows;                                /*!< Number of completed windows */
+} CPU_LOAD_REPORT_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                             API FUNCTIONS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief       Start TIMER2 as the time base of the measurements.
+ * @return      ERROR_t: ERROR_BUSY if TIMER2 is reserved by another module.
+ * @note        Global interrupts are enabled by this function.
+ ******************************************************************************/
+ERROR_t CPU_LOAD_Init(void);
+
+/*******************************************************************************
+ * @brief       Mark the start of idle time: call it before sleeping, or before
+ *              the part of the main loop that only waits for work.
+ ******************************************************************************/
+void CPU_LOAD_IdleEnter(void);
+
+/*******************************************************************************
+ * @brief       Mark the end of idle time: call it after waking up, or when
+ *              work is found.
+ * @par         For Example:
+ *              while(1) {
+ *                  CPU_LOAD_IdleEnter();
+ *                  while(!workToDo);       // or sleep
+ *                  CPU_LOAD_IdleExit();
+ *                  doWork();
+ *              }
+ ******************************************************************************/
+void CPU_LOAD_IdleExit(void);
+
+/*******************************************************************************
+ * @brief       Mark the start of an ISR. Call it first in the ISR (or its
+ *              callback) to measure the time of the ISR.
+ * @param[in]   isr: See \ref CPU_LOAD_ISR_t.
+ * @note        The time of ISRs that interrupt idle time is not counted as idle.
+ ******************************************************************************/
+void CPU_LOAD_IsrEnter(const CPU_LOAD_ISR_t isr);
+
+/*******************************************************************************
+ * @brief       Mark the end of an ISR started by \ref CPU_LOAD_IsrEnter.
+ * @param[in]   isr: See \ref CPU_LOAD_ISR_t.
+ ******************************************************************************/
+void CPU_LOAD_IsrExit(const CPU_LOAD_ISR_t isr);
+
+/*******************************************************************************
+ * @brief       Get the measurements of the last completed window.
+ * @param[out]  ptrToReport: See \ref CPU_LOAD_REPORT_t.
+ * @return      ERROR_t: ERROR_BUSY if no window is completed yet.
+ ******************************************************************************/
+ERROR_t CPU_LOAD_GetReport(CPU_LOAD_REPORT_t * const ptrToReport);
+
+/*******************************************************************************
+ * @brief       Print the last report on one line (see CPU_LOAD_SendString in
+ *              CPU_LOAD_cfg.h), For Example:
+ *              "LOAD 23.4% PEAK 1840us ISR 1.2% 0.3% 0.1%"
+ * @return      ERROR_t: ERROR_BUSY if no window is completed yet.
+ ******************************************************************************/
+ERROR_t CPU_LOAD_SendReport(void);
+
+#endif      /* CPU_LOAD_H */
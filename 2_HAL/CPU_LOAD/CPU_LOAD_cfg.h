@@ -0,0 +1,49 @@
+/******************************************************************************
+ * @file        CPU_LOAD_cfg.h
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Configuration header file for \ref CPU_LOAD.c
+ * @version     1.0.0
+ * @date        2022-07-16
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#ifndef CPU_LOAD_CFG_H
+#define CPU_LOAD_CFG_H
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Clock of TIMER2 used as the time base of the measurements.
+ * @warning CPU_LOAD_TIMER_PRESCALER must be the divider of CPU_LOAD_TIMER_CLOCK.
+ *          With F_CPU = 8 MHz and F_CPU_64 one tick is 8 us and TIMER2
+ *          overflows every 2.048 ms.
+ ******************************************************************************/
+#define CPU_LOAD_TIMER_CLOCK        F_CPU_64
+#define CPU_LOAD_TIMER_PRESCALER    (64UL)
+
+/******************************************************************************
+ * @brief   Length of a measurement window in timer ticks: 1 second.
+ ******************************************************************************/
+#define CPU_LOAD_WINDOW_TICKS       (F_CPU / CPU_LOAD_TIMER_PRESCALER)
+
+/******************************************************************************
+ * @brief   Functions used by \ref CPU_LOAD_SendReport to print the report.
+ ******************************************************************************/
+#define CPU_LOAD_SendString(string)     UART0_SendString(string)
+#define CPU_LOAD_SendInteger(integer)   UART0_SendInteger(integer)
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#if (CPU_LOAD_WINDOW_TICKS == 0) || (CPU_LOAD_WINDOW_TICKS > 0x7FFFFFFFUL)
+#error "CPU_LOAD_WINDOW_TICKS is out of range"
+#endif
+
+#endif    /* CPU_LOAD_CFG_H */
@@ -54,6 +54,7 @@
 #include "BIT_MATH.h"
 #include "DIO.h"
 #include "TIMER.h"
+#include "ADC.h"
 #include "WHEELS.h"
 #include "WHEELS_cfg.h"
 
@@ -204,16 +205,23 @@ WHEELS_POSITION_t WHEELS_GetWheelsPosition(void) {
 }
 
 
-#if 0       /* Uncomment after implementing ADC driver and include ADC.h */
-f32_t WHEELS_GetCurrentConsumption(void) {
-	f32_t Current = 0;
+ERROR_t WHEELS_GetCurrentConsumption(u16_t * const ptrToMilliamps) {
+    ERROR_t error = ERROR_OK;
+    u16_t millivoltsA = 0;
+    u16_t millivoltsB = 0;
 
-	Current = ADC_ReadVoltage(WHEELS_Config.CTA_pin, WHEELS_Config.CTA_port);
-    Current += ADC_ReadVoltage(WHEELS_Config.CTB_pin, WHEELS_Config.CTB_port);
+    if(NULL == ptrToMilliamps) {
+        return ERROR_NULL_POINTER;
+    }
 
-    Current /= (2 * WHEELS_Config.currentSensitivity);
+    error |= ADC_ReadMillivolts(WHEELS_Config.CTA_channel, &millivoltsA);
+    error |= ADC_ReadMillivolts(WHEELS_Config.CTB_channel, &millivoltsB);
 
-	return Current;
-}
+    /* mA = mV * 1000 / (mV/A), for the mean of the two motors */
+    if(ERROR_OK == error) {
+        *ptrToMilliamps = (u16_t)( (((u32_t)millivoltsA + millivoltsB) * 1000UL) /
+                                   (2UL * WHEELS_Config.currentSensitivity) );
+    }
 
-#endif
\ No newline at end of file
+	return error;
+}
\ No newline at end of file
@@ -67,10 +67,11 @@ void WHEELS_SetSpeed(u8_t Speed);
 void WHEELS_SetWheelsPosition(WHEELS_POSITION_t wheelsPositions);
 
 /****************************************************************************
- * @brief Get the current consumption of the wheels.
- * @return f32_t The current consumption of the wheels in A.
+ * @brief Get the current consumption of the wheels: the mean of the currents
+ *        of the two motors, from CTA and CTB.
+ * @param[out] ptrToMilliamps: The current consumption of the wheels in mA.
  ***************************************************************************/
-f32_t WHEELS_GetCurrentConsumption();
+ERROR_t WHEELS_GetCurrentConsumption(u16_t * const ptrToMilliamps);
 
 /****************************************************************************
  * @brief Get the current position of the wheels.
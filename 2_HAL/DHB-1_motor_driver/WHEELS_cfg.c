@@ -10,6 +10,7 @@
 #include "BIT_MATH.h"
 #include "DIO.h"
 #include "TIMER.h"
+#include "ADC.h"
 #include "WHEELS.h"
 #include "WHEELS_cfg.h"
 
@@ -25,11 +26,8 @@ WHEELS_CONFIG_t WHEELS_Config = {
     .IN1B_channel    = PWM_2,    
     .IN2B_channel    = PWM_3,
 
-    .CTA_pin    = DIO_PIN_6,
-    .CTA_port   = DIO_PORT_A,
-
-    .CTB_pin    = DIO_PIN_7,
-    .CTB_port   = DIO_PORT_A,
+    .CTA_channel    = ADC_CHANNEL_MOTOR_A_CURRENT,
+    .CTB_channel    = ADC_CHANNEL_MOTOR_B_CURRENT,
 
     .currentSensitivity = 155,  /* 155 mV/A */
     .SpeedPercentage    = 60,      /* Speed = 60% */
@@ -20,10 +20,8 @@ typedef struct {
     PWM_t   IN1B_channel;
     PWM_t   IN2B_channel;
 
-    DIO_PIN_t   CTA_pin;
-    DIO_PORT_t  CTA_port;
-    DIO_PIN_t   CTB_pin;
-    DIO_PORT_t  CTB_port;
+    ADC_CHANNEL_t   CTA_channel;    /* Configured in ADC_cfg.c */
+    ADC_CHANNEL_t   CTB_channel;
 
     u8_t      currentSensitivity; /* In mV/A */
     u8_t      SpeedPercentage;    /* 0 - 100 */
@@ -9,10 +9,10 @@
 #ifndef NRF24_H       
 #define NRF24_H       
 
-void NRF24_Init(void);
-void NRF24_TxMode(void);
-void NRF24_SendString(u8_t *data, u8_t length);
-void NRF24_RxMode(void);
+ERROR_t NRF24_Init(void);
+ERROR_t NRF24_TxMode(void);
+ERROR_t NRF24_SendString(u8_t *data, u8_t length);
+ERROR_t NRF24_RxMode(void);
 u8_t NRF24_Available(void);
 ERROR_t NRF24_ReceiveString(u8_t *data, u8_t length);
 
@@ -18,7 +18,6 @@
 
 NRF24_t NRF24_cfg = {
     .pins  = {  .ce  = { .pin = DIO_PIN_7, .port = DIO_PORT_E },
-                .csn = { .pin = DIO_PIN_0, .port = DIO_PORT_B } 
              },
     .channel    = 76,          /* Channel number */
     .payload_len = 20,      /* Use static payload length ... */
@@ -9,6 +9,9 @@
 #ifndef NRF24_CFG_H
 #define NRF24_CFG_H
 
+/* Tries of SPI_BUS_Select() while another device or the SPI_BUS queue uses the bus */
+#define NRF24_SELECT_TIMEOUT    (10000UL)
+
 typedef struct{
     DIO_PIN_t   pin;
     DIO_PORT_t  port;
@@ -16,7 +19,6 @@ typedef struct{
 
 typedef struct{
     CONNECTIONS_t ce;
-    CONNECTIONS_t csn;
     CONNECTIONS_t irq;
 }PINS_t;
 
@@ -0,0 +1,281 @@
+/**************************************************************************
+ * @file        SOFT_PWM.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Software PWM on any DIO pins from one compare channel of TIMER1
+ * @details     All channels are set HIGH at the start of a period, and each
+ *              channel is cleared at its own off time. The off times are kept
+ *              sorted in a schedule, and the compare register is moved from
+ *              one edge to the next. So a period costs (number of different
+ *              duty cycles + 1) interrupts instead of a fixed high rate tick.
+ *
+ *              \ref SOFT_PWM_Write builds a new schedule in a second buffer,
+ *              and the ISR swaps the two buffers at the start of the next
+ *              period. So the duty cycles are always updated together.
+ * @version     1.0.0
+ * @date        2022-07-18
+ * @copyright   Copyright (c) 2022
+ **************************************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "SREG.h"
+#include "GIE.h"
+#include "DIO.h"
+#include "TIMER.h"
+#include "TIMER_cfg.h"
+#include "SOFT_PWM.h"
+#include "SOFT_PWM_cfg.h"
+
+#if (TIMER_HANDLERS_BINDING == BINDING_STATIC)
+#error "SOFT_PWM: the timer callbacks are ignored with BINDING_STATIC, set TIMER_HANDLERS_BINDING to BINDING_RUNTIME"
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE TYPES                                   */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+typedef struct {
+    u8_t    order[NUM_OF_SOFT_PWM_CHANNELS];        /*!< Index of the channels sorted by off time */
+    u16_t   offTicks[NUM_OF_SOFT_PWM_CHANNELS];     /*!< Sorted off times from the start of the period */
+    u8_t    countEdges;                             /*!< Channels with 0 < duty cycle < 100 */
+    u8_t    isOn[NUM_OF_SOFT_PWM_CHANNELS];         /*!< State of each channel at the start of the period */
+} SOFT_PWM_SCHEDULE_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                      PRIVATE FUNCTIONS PROTOTYPES                            */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static ERROR_t SOFT_PWM_GetChannelIndex(const SOFT_PWM_CHANNEL_t channel, s8_t * const index);
+static void SOFT_PWM_BuildSchedule(SOFT_PWM_SCHEDULE_t * const schedule);
+static void SOFT_PWM_Compare(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE VARIABLES                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static SOFT_PWM_SCHEDULE_t schedules[2];
+static volatile u8_t activeSchedule = 0;        /*!< Schedule used by the ISR */
+static volatile u8_t isSwapPending = 0;         /*!< The other schedule is ready */
+
+static u8_t dutyCycles[NUM_OF_SOFT_PWM_CHANNELS];
+static volatile u8_t * ports[NUM_OF_SOFT_PWM_CHANNELS];
+static u8_t masks[NUM_OF_SOFT_PWM_CHANNELS];
+
+static u16_t periodStart = 0;                   /*!< TCNT1 at the start of the current period */
+static u8_t nextEdge = 0;                       /*!< Index of the next edge in the active schedule */
+
+static u16_t maxIsrTicks = 0;
+static u16_t periodIsrTicks = 0;
+static u16_t lastPeriodIsrTicks = 0;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              MACRO LIKE FUNCTIONS                            */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*!< TIMER_RES_OCA, TIMER_RES_OCB and TIMER_RES_OCC follow the order of TIMER_OCx_t */
+#define SOFT_PWM_TIMER_RESOURCES    (TIMER_RES_COUNTER | (TIMER_RES_OCA << SOFT_PWM_TIMER_OC))
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PUBLIC FUNCTIONS                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+ERROR_t SOFT_PWM_Init(void) {
+    ERROR_t error = ERROR_OK;
+    u8_t i = 0;
+
+    if(countSoftPwmChannelsConfigured > NUM_OF_SOFT_PWM_CHANNELS) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    error |= TIMER_Reserve(TIMER_1, SOFT_PWM_TIMER_RESOURCES, TIMER_USER_SOFT_PWM,
+                           SOFT_PWM_TIMER_CLOCK, TIMER_MODE_NORMAL);
+
+    for(i = 0; (ERROR_OK == error) && (i < countSoftPwmChannelsConfigured); ++i) {
+        error |= DIO_GetPinRegister(softPwmConfigs[i].pin, &ports[i], &masks[i]);
+        error |= DIO_SetPinDirection(softPwmConfigs[i].pin, DIO_OUTPUT);
+        dutyCycles[i] = 0;
+    }
+
+    if(ERROR_OK == error) {
+        GIE_Disable();
+
+        SOFT_PWM_BuildSchedule(&schedules[0]);
+        activeSchedule = 0;
+        isSwapPending = 0;
+
+        /*!< Keep the counter value: TIMER1 may be running for other users (ICU) */
+        TIMER1_Init(TIMER1_GetTimerValue(), SOFT_PWM_TIMER_CLOCK, TIMER_MODE_NORMAL,
+                    NO_OC, SOFT_PWM_TIMER_OC);
+
+        /*!< The first compare match starts the first period */
+        nextEdge = schedules[0].countEdges;
+        periodStart = (u16_t)(TIMER1_GetTimerValue() + (2 * SOFT_PWM_MIN_EDGE_TICKS) - SOFT_PWM_PERIOD_TICKS);
+        TIMER1_SetCompareValue((u16_t)(periodStart + SOFT_PWM_PERIOD_TICKS), SOFT_PWM_TIMER_OC);
+
+        TIMER1_EnableCompareMatchInterrupt(SOFT_PWM_TIMER_OC, SOFT_PWM_Compare);  /*!< Enables GIE */
+    }
+
+    return error;
+}
+
+ERROR_t SOFT_PWM_Write(const SOFT_PWM_CHANNEL_t channel, const u8_t dutyCyclePercentage) {
+    ERROR_t error = ERROR_OK;
+    s8_t i = -1;
+    u8_t u8_tSreg = 0;
+    u8_t inactive = 0;
+
+    if(dutyCyclePercentage > 100) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    error |= SOFT_PWM_GetChannelIndex(channel, &i);
+
+    if( (ERROR_OK == error) && (i >= 0) ) {
+        dutyCycles[i] = dutyCyclePercentage;
+
+        /*!< Cancel a pending swap, so the ISR does not use the schedule while building it */
+        u8_tSreg = SREG;
+        GIE_Disable();
+        isSwapPending = 0;
+        inactive = activeSchedule ^ 1;
+        SREG = u8_tSreg;
+
+        SOFT_PWM_BuildSchedule(&schedules[inactive]);
+
+        isSwapPending = 1;
+    } else {
+        error |= ERROR_INVALID_PARAMETER;
+    }
+
+    return error;
+}
+
+ERROR_t SOFT_PWM_GetIsrCost(SOFT_PWM_COST_t * const ptrToCost) {
+    const u8_t u8_tSreg = SREG;
+
+    if(NULL == ptrToCost) {
+        return ERROR_NULL_POINTER;
+    }
+
+    GIE_Disable();
+    ptrToCost->maxIsrTicks      = maxIsrTicks;
+    ptrToCost->periodIsrTicks   = lastPeriodIsrTicks;
+    SREG = u8_tSreg;
+
+    return ERROR_OK;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE FUNCTIONS                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+static ERROR_t SOFT_PWM_GetChannelIndex(const SOFT_PWM_CHANNEL_t channel, s8_t * const index) {
+    u8_t i = 0;
+
+    if(NULL == index) {
+        return ERROR_NULL_POINTER;
+    } else {
+        *index = -1;
+    }
+
+    for(i = 0; i < countSoftPwmChannelsConfigured; ++i) {
+        if(softPwmConfigs[i].channel == channel) {
+            *index = i;
+            break;
+        }
+    }
+
+    return ERROR_OK;
+}
+
+/**************************************************************************
+ * @brief  Build a schedule from the duty cycles (insertion sort of the off
+ *         times: the number of channels is small).
+ *************************************************************************/
+static void SOFT_PWM_BuildSchedule(SOFT_PWM_SCHEDULE_t * const schedule) {
+    u16_t offTicks = 0;
+    u8_t i = 0;
+    u8_t j = 0;
+
+    schedule->countEdges = 0;
+
+    for(i = 0; i < countSoftPwmChannelsConfigured; ++i) {
+        schedule->isOn[i] = (dutyCycles[i] > 0) ? 1 : 0;
+
+        if( (dutyCycles[i] > 0) && (dutyCycles[i] < 100) ) {
+            offTicks = (u16_t)( ((u32_t)SOFT_PWM_PERIOD_TICKS * dutyCycles[i]) / 100 );
+
+            for(j = schedule->countEdges; (j > 0) && (schedule->offTicks[j - 1] > offTicks); --j) {
+                schedule->offTicks[j] = schedule->offTicks[j - 1];
+                schedule->order[j]    = schedule->order[j - 1];
+            }
+            schedule->offTicks[j] = offTicks;
+            schedule->order[j]    = i;
+            ++schedule->countEdges;
+        }
+    }
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          CALLBACKS OF TIMER ISRs                             */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+static void SOFT_PWM_Compare(void) {
+    const u16_t isrStart = TIMER1_GetTimerValue();
+    const SOFT_PWM_SCHEDULE_t * schedule = &schedules[activeSchedule];
+    u16_t nextTime = 0;
+    u16_t isrTicks = 0;
+    u8_t i = 0;
+
+    do {
+        if(nextEdge < schedule->countEdges) {
+            /*!< Off time of a channel */
+            i = schedule->order[nextEdge];
+            *ports[i] &= ~masks[i];
+            ++nextEdge;
+        } else {
+            /*!< Start of a new period: apply the new schedule if any */
+            periodStart += SOFT_PWM_PERIOD_TICKS;
+            lastPeriodIsrTicks = periodIsrTicks;
+            periodIsrTicks = 0;
+
+            if(isSwapPending) {
+                activeSchedule ^= 1;
+                isSwapPending = 0;
+                schedule = &schedules[activeSchedule];
+            }
+
+            for(i = 0; i < countSoftPwmChannelsConfigured; ++i) {
+                if(schedule->isOn[i]) {
+                    *ports[i] |= masks[i];
+                } else {
+                    *ports[i] &= ~masks[i];
+                }
+            }
+            nextEdge = 0;
+        }
+
+        nextTime = (nextEdge < schedule->countEdges) ? schedule->offTicks[nextEdge] : SOFT_PWM_PERIOD_TICKS;
+
+        /*!< Handle the next edge now if it is too close: its compare match would be missed */
+    } while( ((s16_t)(TIMER1_GetTimerValue() - periodStart) + (s16_t)SOFT_PWM_MIN_EDGE_TICKS) >= (s16_t)nextTime );
+
+    TIMER1_SetCompareValue((u16_t)(periodStart + nextTime), SOFT_PWM_TIMER_OC);
+
+    isrTicks = (u16_t)(TIMER1_GetTimerValue() - isrStart);
+    periodIsrTicks += isrTicks;
+    if(isrTicks > maxIsrTicks) {
+        maxIsrTicks = isrTicks;
+    }
+}
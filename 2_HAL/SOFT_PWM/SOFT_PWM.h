@@ -0,0 +1,71 @@
+/******************************************************************************
+ * @file            SOFT_PWM.h
+ * @author          Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief           Interfaces header file for \ref SOFT_PWM.c
+ * @version         1.0.0
+ * @date            2022-07-18
+ * PRECONDITIONS:   - TIMER.c and DIO.c must be included in the project
+ *                  - DIO.h must be included before SOFT_PWM.h
+ * @copyright       Copyright (c) 2022
+ ******************************************************************************/
+#ifndef SOFT_PWM_H
+#define SOFT_PWM_H
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Names of the software PWM channels. Change it to your needs, and
+ *          configure the pin of each channel in SOFT_PWM_cfg.c
+ ******************************************************************************/
+typedef enum {
+    SOFT_PWM_LED_0,
+    SOFT_PWM_LED_1,
+    SOFT_PWM_LED_2,
+    NUM_OF_SOFT_PWM_CHANNELS
+} SOFT_PWM_CHANNEL_t;
+
+/******************************************************************************
+ * @brief   Time spent in the compare ISR, in timer ticks.
+ ******************************************************************************/
+typedef struct {
+    u16_t   maxIsrTicks;        /*!< Longest single ISR */
+    u16_t   periodIsrTicks;     /*!< All ISRs of the last period: divide by the
+                                     number of channels to get the cost per channel */
+} SOFT_PWM_COST_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                             API FUNCTIONS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief       Initialize the channels configured in SOFT_PWM_cfg.c (duty cycle
+ *              0 %) and start the compare ISR on TIMER1.
+ * @return      ERROR_t: ERROR_BUSY if TIMER1 or its compare channel is reserved
+ *              by another module with another configuration.
+ * @note        Global interrupts are enabled by this function.
+ ******************************************************************************/
+ERROR_t SOFT_PWM_Init(void);
+
+/*******************************************************************************
+ * @brief       Set the duty cycle of a channel.
+ * @param[in]   channel: See \ref SOFT_PWM_CHANNEL_t.
+ * @param[in]   dutyCyclePercentage: 0 - 100 %.
+ * @note        The new duty cycles are applied together at the start of the next
+ *              period, so a period never mixes the old and the new values.
+ * @note        Must not be called from ISRs.
+ ******************************************************************************/
+ERROR_t SOFT_PWM_Write(const SOFT_PWM_CHANNEL_t channel, const u8_t dutyCyclePercentage);
+
+/*******************************************************************************
+ * @brief       Get the measured time spent in the compare ISR.
+ * @param[out]  ptrToCost: See \ref SOFT_PWM_COST_t.
+ ******************************************************************************/
+ERROR_t SOFT_PWM_GetIsrCost(SOFT_PWM_COST_t * const ptrToCost);
+
+#endif      /* SOFT_PWM_H */
@@ -0,0 +1,42 @@
+/******************************************************************************
+ * @file        SOFT_PWM_cfg.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Configuration source file for \ref SOFT_PWM.c
+ * @version     1.0.0
+ * @date        2022-07-18
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "SOFT_PWM.h"
+#include "SOFT_PWM_cfg.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Configuration of the software PWM channels.
+ * @note    The pins must be configured as outputs in DIO_cfg.c.
+ ******************************************************************************/
+const SOFT_PWM_CONFIGS_t softPwmConfigs[] = {
+    {SOFT_PWM_LED_0, DIO_PINS_LED_0},
+    {SOFT_PWM_LED_1, DIO_PINS_LED_1},
+    {SOFT_PWM_LED_2, DIO_PINS_LED_2},
+};
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Number of used software PWM channels.
+ * @details This variable counts the number of used channels which is equal to
+ *          the number of elements in the \ref softPwmConfigs array.
+ ******************************************************************************/
+const u8_t countSoftPwmChannelsConfigured = sizeof(softPwmConfigs) / sizeof(softPwmConfigs[0]);
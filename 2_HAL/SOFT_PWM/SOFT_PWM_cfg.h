@@ -0,0 +1,68 @@
+/******************************************************************************
+ * @file        SOFT_PWM_cfg.h
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Configuration header file for \ref SOFT_PWM.c
+ * @version     1.0.0
+ * @date        2022-07-18
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#ifndef SOFT_PWM_CFG_H
+#define SOFT_PWM_CFG_H
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Clock of TIMER1. TIMER1 runs freely in normal mode, so it can be
+ *          shared with the ICU (see ICU_cfg.c) if both use the same clock.
+ ******************************************************************************/
+#define SOFT_PWM_TIMER_CLOCK        F_CPU_8
+
+/******************************************************************************
+ * @brief   Compare channel of TIMER1 used by the software PWM.
+ ******************************************************************************/
+#define SOFT_PWM_TIMER_OC           TIMER_OCB
+
+/******************************************************************************
+ * @brief   Period of the PWM signals in timer ticks (maximum 0x7000).
+ *          With F_CPU = 8 MHz and F_CPU_8: 10000 ticks = 10 ms (100 Hz).
+ ******************************************************************************/
+#define SOFT_PWM_PERIOD_TICKS       (10000U)
+
+/******************************************************************************
+ * @brief   Edges closer than this number of ticks to the current time are
+ *          handled in the same ISR: the compare match would be missed
+ *          otherwise. It must be longer than the ISR latency.
+ ******************************************************************************/
+#define SOFT_PWM_MIN_EDGE_TICKS     (16U)
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#if (SOFT_PWM_PERIOD_TICKS > 0x7000U) || (SOFT_PWM_PERIOD_TICKS < (4 * SOFT_PWM_MIN_EDGE_TICKS))
+#error "SOFT_PWM_PERIOD_TICKS is out of range"
+#endif
+
+/******************************************************************************
+ * @brief   This struct is used to pass the configuration of a software PWM
+ *          channel to the APIs of the SOFT_PWM module.
+ * @note    Members:
+ *          - SOFT_PWM_CHANNEL_t channel: The name of the channel.
+ *          - DIO_PINS_t pin: The output pin, configured in DIO_cfg.c.
+ *****************************************************************************/
+typedef struct {
+    SOFT_PWM_CHANNEL_t  channel;
+    DIO_PINS_t          pin;
+} SOFT_PWM_CONFIGS_t;
+
+extern const SOFT_PWM_CONFIGS_t softPwmConfigs[];
+extern const u8_t countSoftPwmChannelsConfigured;
+
+#endif    /* SOFT_PWM_CFG_H */
@@ -0,0 +1,306 @@
+/******************************************************************************
+ * @file        W25Q.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       W25Qxx SPI NOR flash driver.
+ * @details     A page program takes about 0.7 ms and a sector erase about
+ *              45 ms, far more than sending the page (about 0.6 ms at 4 MHz).
+ *              So the program and erase functions return as soon as the
+ *              command is sent, and each command waits for the previous one
+ *              when it starts: the application fills the next page while the
+ *              flash programs the current one.
+ *              The wait reads the status register continuously in one frame
+ *              (one byte per read), and is skipped when no program or erase
+ *              was started since the flash was last seen ready.
+ * @version     1.0.0
+ * @date        2022-08-16
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#include "util/delay.h"
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "W25Q_reg.h"
+#include "SPI.h"
+#include "SPI_BUS.h"
+#include "W25Q.h"
+#include "W25Q_cfg.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE VARIABLES                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+static u32_t W25Q_Capacity = 0;         /*!< In bytes, 0 before W25Q_Init() */
+static u8_t W25Q_IsOperating = 0;       /*!< A program or erase may be in progress */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE FUNCTIONS                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**************************************************************************
+ * @brief  Select the flash, waiting while another device or the queue of
+ *         SPI_BUS uses the bus.
+ *************************************************************************/
+static ERROR_t W25Q_Select(void) {
+    ERROR_t error = ERROR_BUSY;
+    u32_t tries = W25Q_SELECT_TIMEOUT;
+
+    while( (ERROR_BUSY == error) && (tries--) ) {
+        error = SPI_BUS_Select(W25Q_SPI_DEVICE);
+    }
+
+    return error;
+}
+
+/**************************************************************************
+ * @brief  Send a command and the headerLength bytes after it: nothing (0),
+ *         the address (3) or the address and the dummy byte of the fast
+ *         read (4). Then transfer the data bytes in the same frame.
+ *************************************************************************/
+static ERROR_t W25Q_Command(const u8_t command, const u32_t address, const u8_t headerLength,
+                            const u8_t * const txData, u8_t * const rxData, const u16_t length) {
+    ERROR_t error = ERROR_OK;
+    const u8_t header[5] = {
+        command,
+        (u8_t)(address >> 16),
+        (u8_t)(address >> 8),
+        (u8_t)address,
+        0x00U                       /*!< Dummy byte of the fast read */
+    };
+
+    error |= W25Q_Select();
+    if(ERROR_OK != error) {
+        return error;
+    }
+
+    error |= SPI_Burst(header, NULL, (u16_t)1 + headerLength);
+    if(0 != length) {
+        error |= SPI_Burst(txData, rxData, length);
+    }
+
+    error |= SPI_BUS_Deselect(W25Q_SPI_DEVICE);
+
+    return error;
+}
+
+/**************************************************************************
+ * @brief  Wait for the previous operation, then set the write enable latch
+ *         (cleared by the flash after each program or erase).
+ *************************************************************************/
+static ERROR_t W25Q_WriteEnable(void) {
+    ERROR_t error = W25Q_WaitReady();
+
+    if(ERROR_OK == error) {
+        error |= W25Q_Command(W25Q_WRITE_ENABLE, 0, 0, NULL, NULL, 0);
+    }
+
+    return error;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PUBLIC FUNCTIONS                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+ERROR_t W25Q_Init(void) {
+    ERROR_t error = ERROR_OK;
+    u8_t id[3] = {0};
+
+    error |= SPI_BUS_Init();
+    if(ERROR_OK != error) {
+        return error;
+    }
+
+    /*!< Wakes the flash up if the application powered it down before a reset */
+    error |= W25Q_Command(W25Q_RELEASE_POWER_DOWN, 0, 0, NULL, NULL, 0);
+    _delay_us(W25Q_RELEASE_DELAY_US);      /*!< Commands are ignored until tRES1 */
+    error |= W25Q_Command(W25Q_JEDEC_ID, 0, 0, NULL, id, 3);
+
+    /*!< No flash: MISO floats (0xFF) or is pulled LOW (0x00) */
+    if( (ERROR_OK != error) || (0x00U == id[0]) || (0xFFU == id[0]) || (id[2] > 31) ) {
+        W25Q_Capacity = 0;
+        return error | ERROR_NOK;
+    }
+
+    /*!< Other manufacturers use the same commands: only the capacity is needed.
+         The addresses are 3 bytes: bigger parts (W25Q256, 4 bytes addresses)
+         start in 3 bytes mode and only their first 16 MB are used */
+    if(id[2] > W25Q_MAX_CAPACITY_LOG2) {
+        id[2] = W25Q_MAX_CAPACITY_LOG2;
+    }
+    W25Q_Capacity = (u32_t)1 << id[2];
+    W25Q_IsOperating = 1;       /*!< A program may run since before a reset */
+
+    return error;
+}
+
+ERROR_t W25Q_GetCapacity(u32_t * const ptrToBytes) {
+    if(NULL == ptrToBytes) {
+        return ERROR_NULL_POINTER;
+    }
+
+    *ptrToBytes = W25Q_Capacity;
+
+    return (0 == W25Q_Capacity) ? ERROR_NOT_INITIALIZED : ERROR_OK;
+}
+
+ERROR_t W25Q_Read(const u32_t address, u8_t * const data, const u16_t length) {
+    ERROR_t error = ERROR_OK;
+
+    if(NULL == data) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if(0 == W25Q_Capacity) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    if( (address >= W25Q_Capacity) || (length > (W25Q_Capacity - address)) ) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    error |= W25Q_WaitReady();
+    if(ERROR_OK == error) {
+        error |= W25Q_Command(W25Q_FAST_READ, address, 4, NULL, data, length);
+    }
+
+    return error;
+}
+
+ERROR_t W25Q_ProgramPage(const u32_t address, const u8_t * const data, const u16_t length) {
+    ERROR_t error = ERROR_OK;
+
+    if(NULL == data) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if(0 == W25Q_Capacity) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    /*!< The flash wraps to the start of the page: refuse instead */
+    if( (address >= W25Q_Capacity) || (0 == length) ||
+        (length > (W25Q_PAGE_SIZE - (address & (W25Q_PAGE_SIZE - 1)))) ) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    error |= W25Q_WriteEnable();
+    if(ERROR_OK == error) {
+        error |= W25Q_Command(W25Q_PAGE_PROGRAM, address, 3, data, NULL, length);
+        W25Q_IsOperating = 1;
+    }
+
+    return error;
+}
+
+ERROR_t W25Q_EraseSector(const u32_t address) {
+    ERROR_t error = ERROR_OK;
+
+    if(0 == W25Q_Capacity) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    if(address >= W25Q_Capacity) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    error |= W25Q_WriteEnable();
+    if(ERROR_OK == error) {
+        error |= W25Q_Command(W25Q_SECTOR_ERASE, address, 3, NULL, NULL, 0);
+        W25Q_IsOperating = 1;
+    }
+
+    return error;
+}
+
+ERROR_t W25Q_Write(u32_t address, const u8_t * data, u32_t length) {
+    ERROR_t error = ERROR_OK;
+    u16_t pageLength = 0;
+
+    if(NULL == data) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if(0 == W25Q_Capacity) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    if( (address >= W25Q_Capacity) || (length > (W25Q_Capacity - address)) ) {
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    while( (0 != length) && (ERROR_OK == error) ) {
+        /*!< Up to the end of the page of the address */
+        pageLength = W25Q_PAGE_SIZE - (u16_t)(address & (W25Q_PAGE_SIZE - 1));
+        if(pageLength > length) {
+            pageLength = (u16_t)length;
+        }
+
+        error |= W25Q_ProgramPage(address, data, pageLength);
+
+        address += pageLength;
+        data += pageLength;
+        length -= pageLength;
+    }
+
+    return error;
+}
+
+ERROR_t W25Q_IsBusy(STATE_t * const ptrToState) {
+    ERROR_t error = ERROR_OK;
+    u8_t status = 0;
+
+    if(NULL == ptrToState) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if(0 == W25Q_IsOperating) {
+        *ptrToState = LOW;
+        return ERROR_OK;
+    }
+
+    error |= W25Q_Command(W25Q_READ_STATUS_1, 0, 0, NULL, &status, 1);
+    if(ERROR_OK != error) {
+        return error;
+    }
+
+    if(BIT_IS_SET(status, W25Q_BUSY)) {
+        *ptrToState = HIGH;
+    } else {
+        *ptrToState = LOW;
+        W25Q_IsOperating = 0;
+    }
+
+    return error;
+}
+
+ERROR_t W25Q_WaitReady(void) {
+    ERROR_t error = ERROR_OK;
+    u8_t status = 0;
+    u32_t polls = 0;
+
+    if(0 == W25Q_IsOperating) {
+        return ERROR_OK;
+    }
+
+    /*!< One frame per read: the other devices use the bus between the reads */
+    do {
+        error |= W25Q_Command(W25Q_READ_STATUS_1, 0, 0, NULL, &status, 1);
+        ++polls;
+    } while( (ERROR_OK == error) && BIT_IS_SET(status, W25Q_BUSY) && (polls < W25Q_BUSY_TIMEOUT_POLLS) );
+
+    if(ERROR_OK != error) {
+        return error;
+    }
+
+    if(BIT_IS_SET(status, W25Q_BUSY)) {
+        error |= ERROR_TIMEOUT;
+    } else {
+        W25Q_IsOperating = 0;
+    }
+
+    return error;
+}
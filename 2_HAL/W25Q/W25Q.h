@@ -0,0 +1,98 @@
+/******************************************************************************
+ * @file            W25Q.h
+ * @author          Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief           Interfaces header file for \ref W25Q.c
+ * @version         1.0.0
+ * @date            2022-08-16
+ * PRECONDITIONS:   - SPI.c and SPI_BUS.c must be included in the project
+ *                  - The flash is configured in SPI_BUS_cfg.c
+ * @copyright       Copyright (c) 2022
+ ******************************************************************************/
+#ifndef W25Q_H
+#define W25Q_H
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+#define W25Q_PAGE_SIZE      (256U)      /*!< Largest program, inside a page */
+#define W25Q_SECTOR_SIZE    (4096UL)    /*!< Smallest erase */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                             API FUNCTIONS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief       Initialize the SPI bus and read the JEDEC ID of the flash.
+ * @return      ERROR_t: ERROR_NOK if no flash answers.
+ ******************************************************************************/
+ERROR_t W25Q_Init(void);
+
+/*******************************************************************************
+ * @brief       Size of the flash in bytes, from its JEDEC ID, limited to the
+ *              16 MB reachable with 3 bytes addresses.
+ ******************************************************************************/
+ERROR_t W25Q_GetCapacity(u32_t * const ptrToBytes);
+
+/*******************************************************************************
+ * @brief       Read bytes with the fast read command.
+ * @param[in]   address: First byte, any address.
+ * @param[out]  data: Read bytes.
+ * @param[in]   length: Number of bytes.
+ * @return      ERROR_t: ERROR_TIMEOUT if the flash stays busy.
+ * @note        Waits for the end of a program or erase first.
+ ******************************************************************************/
+ERROR_t W25Q_Read(const u32_t address, u8_t * const data, const u16_t length);
+
+/*******************************************************************************
+ * @brief       Start programming bytes of one page. Programming only clears
+ *              bits: the page must be erased.
+ * @param[in]   address: First byte.
+ * @param[in]   data: Bytes to program. The buffer is free when the function
+ *              returns.
+ * @param[in]   length: Number of bytes: the bytes must be in the same page.
+ * @return      ERROR_t:
+ *              - ERROR_OUT_OF_RANGE: The bytes cross the end of the page.
+ *              - ERROR_TIMEOUT: The previous program or erase did not end.
+ * @note        The function does not wait for the end of the programming
+ *              (about 0.7 ms): fill the next page meanwhile. The next
+ *              command waits for it (\ref W25Q_WaitReady).
+ ******************************************************************************/
+ERROR_t W25Q_ProgramPage(const u32_t address, const u8_t * const data, const u16_t length);
+
+/*******************************************************************************
+ * @brief       Start erasing the 4 KB sector of an address (all bytes 0xFF).
+ * @return      ERROR_t: ERROR_TIMEOUT if the previous operation did not end.
+ * @note        The function does not wait for the end of the erase (about
+ *              45 ms).
+ ******************************************************************************/
+ERROR_t W25Q_EraseSector(const u32_t address);
+
+/*******************************************************************************
+ * @brief       Program any number of bytes from any address, page by page.
+ *              Each page is started while the previous one is programmed.
+ * @return      ERROR_t: ERROR_BUSY if another device keeps the bus for
+ *              W25Q_SELECT_TIMEOUT tries of a select.
+ * @note        The sectors must be erased. The last page is not waited for.
+ ******************************************************************************/
+ERROR_t W25Q_Write(u32_t address, const u8_t * data, u32_t length);
+
+/*******************************************************************************
+ * @brief       Check if a program or erase is in progress, without waiting.
+ * @param[out]  ptrToState: HIGH if busy, LOW otherwise.
+ ******************************************************************************/
+ERROR_t W25Q_IsBusy(STATE_t * const ptrToState);
+
+/*******************************************************************************
+ * @brief       Wait for the end of a program or erase, polling the status
+ *              register. Each read is its own frame: the other devices of
+ *              the bus are served between two reads.
+ * @return      ERROR_t: ERROR_TIMEOUT after W25Q_BUSY_TIMEOUT_POLLS reads.
+ ******************************************************************************/
+ERROR_t W25Q_WaitReady(void);
+
+#endif      /* W25Q_H */
@@ -0,0 +1,44 @@
+/******************************************************************************
+ * @file        W25Q_cfg.h
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Configuration header file for \ref W25Q.c
+ * @version     1.0.0
+ * @date        2022-08-16
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#ifndef W25Q_CFG_H
+#define W25Q_CFG_H
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Device of the flash on the SPI bus (see SPI_BUS_cfg.c).
+ ******************************************************************************/
+#define W25Q_SPI_DEVICE             SPI_DEVICE_FLASH
+
+/******************************************************************************
+ * @brief   Status reads before W25Q_WaitReady() gives up. One read is one
+ *          frame of two bytes, more than 5 us with SCK = 4 MHz: 200000 reads
+ *          are more than 1 s, over the 400 ms max sector erase of the W25Q64.
+ *          Raise it to wait for block or chip erases.
+ ******************************************************************************/
+#define W25Q_BUSY_TIMEOUT_POLLS     (200000UL)
+
+/******************************************************************************
+ * @brief   Tries of SPI_BUS_Select() while another device or the SPI_BUS
+ *          queue uses the bus, before a command returns ERROR_BUSY.
+ ******************************************************************************/
+#define W25Q_SELECT_TIMEOUT         (10000UL)
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif    /* W25Q_CFG_H */
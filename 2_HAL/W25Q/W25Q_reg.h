@@ -0,0 +1,35 @@
+/**************************************************************************
+ * @file        W25Q_reg.h
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Commands and status bits of the W25Qxx SPI NOR flash
+ *              (JEDEC command set, also used by most SPI NOR flashes).
+ * @version     1.0.0
+ * @date        2022-08-16
+ * @copyright   Copyright (c) 2022
+ **************************************************************************/
+#ifndef W25Q_REG_H
+#define W25Q_REG_H
+
+#define W25Q_WRITE_ENABLE           (0x06U)
+#define W25Q_READ_STATUS_1          (0x05U)
+#define W25Q_PAGE_PROGRAM           (0x02U)
+#define W25Q_SECTOR_ERASE           (0x20U)     /*!< 4 KB */
+#define W25Q_BLOCK_ERASE_64K        (0xD8U)
+#define W25Q_CHIP_ERASE             (0xC7U)
+#define W25Q_READ_DATA              (0x03U)
+#define W25Q_FAST_READ              (0x0BU)     /*!< Followed by one dummy byte */
+#define W25Q_JEDEC_ID               (0x9FU)
+#define W25Q_POWER_DOWN             (0xB9U)
+#define W25Q_RELEASE_POWER_DOWN     (0xABU)
+
+enum {
+    W25Q_BUSY,      /* Erase or program in progress */
+    W25Q_WEL,       /* Write enable latch */
+};  /* Status register 1 */
+
+#define W25Q_MANUFACTURER_WINBOND   (0xEFU)
+
+#define W25Q_RELEASE_DELAY_US       (3U)        /*!< tRES1: release power down to next command */
+#define W25Q_MAX_CAPACITY_LOG2      (24U)       /*!< Reachable with 3 bytes addresses */
+
+#endif    /* W25Q_REG_H */
@@ -0,0 +1,138 @@
+/******************************************************************************
+ * @file        W25Q_bench.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Program pages with \ref W25Q.c on the simulated flash and print
+ *              the throughput, with and without overlapping the fill of the
+ *              next page with the programming of the current one.
+ * @details     Usage: w25q_bench [-p pages] [-f fillUs]
+ *              - pages: Number of pages of 256 bytes to program (default 256).
+ *              - fillUs: Time the application needs to fill a page, in us
+ *                (default 300): sampling, formatting...
+ *              The modes:
+ *              - wait:      fill, W25Q_ProgramPage(), W25Q_WaitReady().
+ *              - pipelined: fill, W25Q_ProgramPage(). The next command waits.
+ *              Each mode erases its own sectors first, and reads the pages
+ *              back to check them. The times are simulated (see
+ *              W25Q_HOST_TIMINGS_t), not measured on an AVR.
+ * @version     1.0.0
+ * @date        2022-08-16
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define size_t  W25Q_HOST_SIZE_T    /*!< STD_TYPES.h defines size_t for the AVR */
+#include "STD_TYPES.h"
+#undef size_t
+#include "W25Q.h"
+#include "W25Q_host.h"
+
+typedef enum {
+    BENCH_WAIT,
+    BENCH_PIPELINED,
+    NUM_OF_BENCH_MODES
+} BENCH_MODE_t;
+
+static const char * const modeNames[NUM_OF_BENCH_MODES] = {"wait", "pipelined"};
+
+static ERROR_t BENCH_Run(const BENCH_MODE_t mode, const u32_t pages, const f64_t fillSeconds);
+
+int main(int argc, char * argv[]) {
+    ERROR_t error = ERROR_OK;
+    u32_t pages = 256;
+    f64_t fillUs = 300;
+    u32_t capacity = 0;
+    int i = 0;
+
+    for(i = 1; i < argc; ++i) {
+        if( (0 == strcmp(argv[i], "-p")) && (i + 1 < argc) ) {
+            pages = strtoul(argv[++i], NULL, 0);
+        } else if( (0 == strcmp(argv[i], "-f")) && (i + 1 < argc) ) {
+            fillUs = strtod(argv[++i], NULL);
+        } else {
+            fprintf(stderr, "usage: %s [-p pages] [-f fillUs]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if( (ERROR_OK != W25Q_HostInit(NULL)) || (ERROR_OK != W25Q_Init()) ) {
+        fprintf(stderr, "can not initialize the flash\n");
+        return 1;
+    }
+
+    W25Q_GetCapacity(&capacity);
+    if( (0 == pages) || (pages * W25Q_PAGE_SIZE * NUM_OF_BENCH_MODES > capacity) ) {
+        fprintf(stderr, "pages must be 1 to %lu\n", (unsigned long)(capacity / W25Q_PAGE_SIZE / NUM_OF_BENCH_MODES));
+        return 1;
+    }
+
+    printf("%lu pages, fill %.0f us per page, flash of %lu KB\n\n", (unsigned long)pages, fillUs,
+           (unsigned long)(capacity / 1024));
+    printf("mode       erase ms  program ms  program KB/s  status reads  read KB/s  check\n");
+
+    for(i = 0; i < NUM_OF_BENCH_MODES; ++i) {
+        error |= BENCH_Run((BENCH_MODE_t)i, pages, fillUs * 1e-6);
+    }
+
+    W25Q_HostFree();
+
+    return (ERROR_OK == error) ? 0 : 1;
+}
+
+static ERROR_t BENCH_Run(const BENCH_MODE_t mode, const u32_t pages, const f64_t fillSeconds) {
+    ERROR_t error = ERROR_OK;
+    const u32_t bytes = pages * W25Q_PAGE_SIZE;
+    const u32_t start = mode * ((bytes + W25Q_SECTOR_SIZE - 1) & ~(W25Q_SECTOR_SIZE - 1));
+    W25Q_HOST_STATS_t before;
+    W25Q_HOST_STATS_t after;
+    u8_t page[W25Q_PAGE_SIZE];
+    u8_t readBack[W25Q_PAGE_SIZE];
+    f64_t t0 = 0;
+    f64_t eraseSeconds = 0;
+    f64_t programSeconds = 0;
+    f64_t readSeconds = 0;
+    u32_t mismatches = 0;
+    u32_t address = 0;
+    u32_t p = 0;
+    u16_t i = 0;
+
+    t0 = W25Q_HostGetTime();
+    for(address = start; address < start + bytes; address += W25Q_SECTOR_SIZE) {
+        error |= W25Q_EraseSector(address);
+    }
+    error |= W25Q_WaitReady();
+    eraseSeconds = W25Q_HostGetTime() - t0;
+
+    W25Q_HostGetStats(&before);
+    t0 = W25Q_HostGetTime();
+    for(p = 0; p < pages; ++p) {
+        for(i = 0; i < W25Q_PAGE_SIZE; ++i) {
+            page[i] = (u8_t)(p * 7 + i + mode);
+        }
+        W25Q_HostSpend(fillSeconds);
+
+        error |= W25Q_ProgramPage(start + p * W25Q_PAGE_SIZE, page, W25Q_PAGE_SIZE);
+        if(BENCH_WAIT == mode) {
+            error |= W25Q_WaitReady();
+        }
+    }
+    error |= W25Q_WaitReady();     /*!< The data is in the flash */
+    programSeconds = W25Q_HostGetTime() - t0;
+    W25Q_HostGetStats(&after);
+
+    t0 = W25Q_HostGetTime();
+    for(p = 0; p < pages; ++p) {
+        error |= W25Q_Read(start + p * W25Q_PAGE_SIZE, readBack, W25Q_PAGE_SIZE);
+        for(i = 0; i < W25Q_PAGE_SIZE; ++i) {
+            mismatches += (readBack[i] != (u8_t)(p * 7 + i + mode));
+        }
+    }
+    readSeconds = W25Q_HostGetTime() - t0;
+
+    printf("%-9s  %8.1f  %10.1f  %12.1f  %12lu  %9.1f  %s\n", modeNames[mode], eraseSeconds * 1e3,
+           programSeconds * 1e3, bytes / 1024.0 / programSeconds,
+           (unsigned long)(after.statusReads - before.statusReads), bytes / 1024.0 / readSeconds,
+           (ERROR_OK != error) ? "error" : (0 != mismatches) ? "mismatch" : "ok");
+
+    return (0 != mismatches) ? (error | ERROR_NOK) : error;
+}
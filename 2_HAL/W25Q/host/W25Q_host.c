@@ -0,0 +1,309 @@
+/******************************************************************************
+ * @file        W25Q_host.c
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Simulated SPI bus and W25Q64 flash, to run \ref W25Q.c on a
+ *              Linux host.
+ * @details     Only the commands used by W25Q.c are simulated. As on the real
+ *              flash, a program or erase starts when the chip select goes
+ *              HIGH, the other commands are ignored while it runs (except the
+ *              status read) and a program wraps inside its page.
+ *              The flash starts powered down: it ignores all the commands but
+ *              the release, then the ones sent before tRES1.
+ * @version     1.0.0
+ * @date        2022-08-16
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#define size_t  W25Q_HOST_SIZE_T    /*!< STD_TYPES.h defines size_t for the AVR */
+#include "STD_TYPES.h"
+#undef size_t
+#include "BIT_MATH.h"
+#include "W25Q_reg.h"
+#include "SPI.h"
+#include "SPI_BUS.h"
+#include "W25Q.h"
+#include "W25Q_host.h"
+
+#define HOST_CAPACITY_LOG2      (23U)       /*!< 8 MB: W25Q64 */
+#define HOST_CAPACITY           ((u32_t)1 << HOST_CAPACITY_LOG2)
+#define HOST_RELEASE_SECONDS    (3e-6)      /*!< tRES1 */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE VARIABLES                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+static W25Q_HOST_TIMINGS_t HOST_Timings;
+static W25Q_HOST_STATS_t HOST_Stats;
+static u8_t * HOST_Memory = NULL;
+static f64_t HOST_Time = 0;             /*!< Simulated seconds */
+static f64_t HOST_BusyUntil = 0;        /*!< End of the program or erase */
+static u8_t HOST_WriteEnabled = 0;      /*!< WEL */
+static u8_t HOST_IsPoweredDown = 1;
+static f64_t HOST_AwakeAt = 0;          /*!< End of tRES1 after a release */
+
+/*!< Frame in progress */
+static s8_t HOST_SelectedDevice = -1;
+static u32_t HOST_FrameIndex = 0;       /*!< Bytes received in the frame */
+static u8_t HOST_Command = 0;
+static u8_t HOST_IsFrameIgnored = 0;
+static u32_t HOST_Address = 0;
+static u8_t HOST_Page[W25Q_PAGE_SIZE];  /*!< Bytes of a page program */
+static u16_t HOST_PageLength = 0;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE FUNCTIONS                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+static u8_t HOST_IsBusy(void) {
+    return HOST_Time < HOST_BusyUntil;
+}
+
+static void HOST_StartOperation(const f64_t seconds) {
+    HOST_WriteEnabled = 0;
+    HOST_BusyUntil = HOST_Time + seconds;
+    HOST_Stats.busySeconds += seconds;
+}
+
+/**************************************************************************
+ * @brief  Clock one byte into the flash, return the byte of MISO.
+ *************************************************************************/
+static u8_t HOST_ClockByte(const u8_t mosi) {
+    const u32_t index = HOST_FrameIndex++;
+    u8_t miso = 0xFFU;
+
+    if(0 == index) {
+        HOST_Command = mosi;
+        HOST_Address = 0;
+        HOST_PageLength = 0;
+        HOST_IsFrameIgnored = ( (HOST_IsPoweredDown || (HOST_Time < HOST_AwakeAt)) &&
+                                (W25Q_RELEASE_POWER_DOWN != mosi) );
+        if(HOST_IsFrameIgnored) {
+            ++HOST_Stats.ignoredFrames;
+        }
+        return miso;
+    }
+
+    if(HOST_IsFrameIgnored) {
+        return miso;
+    }
+
+    /*!< Busy: only the status register answers */
+    if( HOST_IsBusy() && (W25Q_READ_STATUS_1 != HOST_Command) ) {
+        return miso;
+    }
+
+    switch(HOST_Command) {
+        case W25Q_READ_STATUS_1:
+            ++HOST_Stats.statusReads;
+            miso = (u8_t)((HOST_IsBusy() << W25Q_BUSY) | (HOST_WriteEnabled << W25Q_WEL));
+            break;
+
+        case W25Q_JEDEC_ID:
+            if(1 == index) {
+                miso = W25Q_MANUFACTURER_WINBOND;
+            } else if(2 == index) {
+                miso = 0x40U;
+            } else if(3 == index) {
+                miso = HOST_CAPACITY_LOG2;
+            }
+            break;
+
+        case W25Q_FAST_READ:
+        case W25Q_READ_DATA:
+            if(index <= 3) {
+                HOST_Address = (HOST_Address << 8) | mosi;
+            } else if( (W25Q_READ_DATA == HOST_Command) || (index > 4) ) {
+                miso = HOST_Memory[HOST_Address & (HOST_CAPACITY - 1)];
+                ++HOST_Address;
+            }
+            break;
+
+        case W25Q_PAGE_PROGRAM:
+            if(index <= 3) {
+                HOST_Address = (HOST_Address << 8) | mosi;
+            } else {
+                /*!< More than a page: the last 256 bytes are kept */
+                HOST_Page[(HOST_Address + index - 4) & (W25Q_PAGE_SIZE - 1)] = mosi;
+                if(HOST_PageLength < W25Q_PAGE_SIZE) {
+                    ++HOST_PageLength;
+                }
+            }
+            break;
+
+        case W25Q_SECTOR_ERASE:
+            if(index <= 3) {
+                HOST_Address = (HOST_Address << 8) | mosi;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return miso;
+}
+
+/**************************************************************************
+ * @brief  Chip select HIGH: run the command of the frame.
+ *************************************************************************/
+static void HOST_EndFrame(void) {
+    u32_t pageStart = 0;
+    u16_t i = 0;
+    u16_t offset = 0;
+
+    if( (0 == HOST_FrameIndex) || HOST_IsFrameIgnored || HOST_IsBusy() ) {
+        return;
+    }
+
+    switch(HOST_Command) {
+        case W25Q_RELEASE_POWER_DOWN:
+            if(HOST_IsPoweredDown) {
+                HOST_IsPoweredDown = 0;
+                HOST_AwakeAt = HOST_Time + HOST_RELEASE_SECONDS;
+            }
+            break;
+
+        case W25Q_WRITE_ENABLE:
+            HOST_WriteEnabled = 1;
+            break;
+
+        case W25Q_PAGE_PROGRAM:
+            if( HOST_WriteEnabled && (HOST_FrameIndex >= 4) ) {
+                pageStart = (HOST_Address & (HOST_CAPACITY - 1)) & ~(u32_t)(W25Q_PAGE_SIZE - 1);
+                for(i = 0; i < HOST_PageLength; ++i) {
+                    offset = (HOST_Address + i) & (W25Q_PAGE_SIZE - 1);
+                    HOST_Memory[pageStart + offset] &= HOST_Page[offset];     /*!< Only clears bits */
+                }
+                HOST_StartOperation(HOST_Timings.pageProgramSeconds);
+            }
+            break;
+
+        case W25Q_SECTOR_ERASE:
+            if( HOST_WriteEnabled && (4 == HOST_FrameIndex) ) {
+                memset(&HOST_Memory[(HOST_Address & (HOST_CAPACITY - 1)) & ~(W25Q_SECTOR_SIZE - 1)], 0xFF, W25Q_SECTOR_SIZE);
+                HOST_StartOperation(HOST_Timings.sectorEraseSeconds);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PUBLIC FUNCTIONS                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+ERROR_t W25Q_HostInit(const W25Q_HOST_TIMINGS_t * const timings) {
+    const W25Q_HOST_TIMINGS_t defaults = {
+        .cpuHz = F_CPU,
+        .sckHz = F_CPU / 2,
+        .cyclesPerByte = 20,            /*!< 16 cycles of the byte at F_CPU / 2 */
+        .cyclesPerBurst = 30,
+        .cyclesPerSelect = 80,
+        .pageProgramSeconds = 0.7e-3,
+        .sectorEraseSeconds = 45e-3
+    };
+
+    W25Q_HostFree();
+    HOST_Memory = malloc(HOST_CAPACITY);
+    if(NULL == HOST_Memory) {
+        return ERROR_NOK;
+    }
+    memset(HOST_Memory, 0xFF, HOST_CAPACITY);
+
+    HOST_Timings = (NULL != timings) ? *timings : defaults;
+    memset(&HOST_Stats, 0, sizeof(HOST_Stats));
+    HOST_Time = 0;
+    HOST_BusyUntil = 0;
+    HOST_WriteEnabled = 0;
+    HOST_IsPoweredDown = 1;
+    HOST_AwakeAt = 0;
+    HOST_SelectedDevice = -1;
+
+    return ERROR_OK;
+}
+
+void W25Q_HostFree(void) {
+    free(HOST_Memory);
+    HOST_Memory = NULL;
+}
+
+f64_t W25Q_HostGetTime(void) {
+    return HOST_Time;
+}
+
+void W25Q_HostSpend(const f64_t seconds) {
+    HOST_Time += seconds;
+}
+
+void W25Q_HostGetStats(W25Q_HOST_STATS_t * const stats) {
+    *stats = HOST_Stats;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                      SIMULATED SPI.c AND SPI_BUS.c                           */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+ERROR_t SPI_BUS_Init(void) {
+    return (NULL == HOST_Memory) ? ERROR_NOT_INITIALIZED : ERROR_OK;
+}
+
+ERROR_t SPI_BUS_Select(const SPI_DEVICE_t device) {
+    /*!< Not nested, as SPI_BUS.c */
+    if(HOST_SelectedDevice >= 0) {
+        return ERROR_BUSY;
+    }
+
+    HOST_SelectedDevice = (s8_t)device;
+    HOST_FrameIndex = 0;
+    ++HOST_Stats.frames;
+    HOST_Time += HOST_Timings.cyclesPerSelect / HOST_Timings.cpuHz;
+
+    return ERROR_OK;
+}
+
+ERROR_t SPI_BUS_Deselect(const SPI_DEVICE_t device) {
+    if(HOST_SelectedDevice != (s8_t)device) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    HOST_SelectedDevice = -1;
+    HOST_EndFrame();
+
+    return ERROR_OK;
+}
+
+ERROR_t SPI_Burst(const u8_t * txBuffer, u8_t * rxBuffer, u16_t length) {
+    const f64_t byteSeconds = 8.0 / HOST_Timings.sckHz;
+    const f64_t loopSeconds = HOST_Timings.cyclesPerByte / HOST_Timings.cpuHz;
+    u8_t miso = 0;
+
+    if(0 == length) {
+        return ERROR_OK;
+    }
+
+    HOST_Time += HOST_Timings.cyclesPerBurst / HOST_Timings.cpuHz;
+
+    while(length--) {
+        /*!< The byte is sampled at its end */
+        HOST_Time += (loopSeconds > byteSeconds) ? loopSeconds : byteSeconds;
+        ++HOST_Stats.bytes;
+
+        miso = HOST_ClockByte((NULL != txBuffer) ? *txBuffer++ : 0xFFU);
+        if(NULL != rxBuffer) {
+            *rxBuffer++ = miso;
+        }
+    }
+
+    return ERROR_OK;
+}
@@ -0,0 +1,80 @@
+/******************************************************************************
+ * @file            W25Q_host.h
+ * @author          Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief           Interface of the simulated flash used to build \ref W25Q.c
+ *                  on a Linux host (\ref W25Q_host.c)
+ * @details         W25Q_host.c replaces SPI.c and SPI_BUS.c: SPI_Burst()
+ *                  clocks the bytes into a simulated W25Q64 and advances a
+ *                  simulated clock, so the throughput of the driver can be
+ *                  measured without hardware.
+ * @version         1.0.0
+ * @date            2022-08-16
+ * PRECONDITIONS:   STD_TYPES.h must be included before W25Q_host.h
+ * @copyright       Copyright (c) 2022
+ ******************************************************************************/
+#ifndef W25Q_HOST_H
+#define W25Q_HOST_H
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * @brief   Timings of the simulation. The flash ones are the typical values
+ *          of the W25Q64 datasheet, the AVR ones are estimated from the code
+ *          of SPI.c and SPI_BUS.c (not measured).
+ ******************************************************************************/
+typedef struct {
+    f64_t   cpuHz;                  /*!< F_CPU */
+    f64_t   sckHz;                  /*!< SPI clock */
+    f64_t   cyclesPerByte;          /*!< Loop of SPI_Burst() around a byte */
+    f64_t   cyclesPerBurst;         /*!< Call of SPI_Burst() */
+    f64_t   cyclesPerSelect;        /*!< SPI_BUS_Select() + SPI_BUS_Deselect() */
+    f64_t   pageProgramSeconds;     /*!< tPP */
+    f64_t   sectorEraseSeconds;     /*!< tSE */
+} W25Q_HOST_TIMINGS_t;
+
+/******************************************************************************
+ * @brief   Counters of the simulated bus, see \ref W25Q_HostGetStats.
+ ******************************************************************************/
+typedef struct {
+    u32_t   frames;                 /*!< Chip selects */
+    u32_t   bytes;                  /*!< Bytes on the bus */
+    u32_t   statusReads;            /*!< Bytes of status register reads */
+    u32_t   ignoredFrames;          /*!< Sent while powered down or before tRES1 */
+    f64_t   busySeconds;            /*!< Time the flash was programming or erasing */
+} W25Q_HOST_STATS_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                             API FUNCTIONS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * @brief       Create an erased and powered down flash of 8 MB (JEDEC ID
+ *              EF 40 17) and reset the clock.
+ * @param[in]   timings: Timings of the simulation, NULL for the defaults:
+ *              F_CPU, SCK = F_CPU / 2, tPP = 0.7 ms, tSE = 45 ms.
+ * @return      ERROR_t: ERROR_NOK if the memory can not be allocated.
+ ******************************************************************************/
+ERROR_t W25Q_HostInit(const W25Q_HOST_TIMINGS_t * const timings);
+
+void W25Q_HostFree(void);
+
+/*******************************************************************************
+ * @brief       Simulated time since W25Q_HostInit(), in seconds.
+ ******************************************************************************/
+f64_t W25Q_HostGetTime(void);
+
+/*******************************************************************************
+ * @brief       Advance the clock by work of the application (filling a page).
+ *              The flash keeps programming meanwhile.
+ ******************************************************************************/
+void W25Q_HostSpend(const f64_t seconds);
+
+void W25Q_HostGetStats(W25Q_HOST_STATS_t * const stats);
+
+#endif      /* W25Q_HOST_H */
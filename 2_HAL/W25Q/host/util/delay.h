@@ -0,0 +1,18 @@
+/******************************************************************************
+ * @file        delay.h
+ * @author      Mahmoud Karam (ma.karam272@gmail.com)
+ * @brief       Host replacement of avr-libc <util/delay.h>: the delays
+ *              advance the simulated clock of \ref W25Q_host.c
+ * @version     1.0.0
+ * @date        2022-08-16
+ * @copyright   Copyright (c) 2022
+ ******************************************************************************/
+#ifndef W25Q_HOST_DELAY_H
+#define W25Q_HOST_DELAY_H
+
+void W25Q_HostSpend(const double seconds);
+
+#define _delay_us(us)   W25Q_HostSpend((us) * 1e-6)
+#define _delay_ms(ms)   W25Q_HostSpend((ms) * 1e-3)
+
+#endif    /* W25Q_HOST_DELAY_H */